@@ -34,6 +34,8 @@ struct Configuration {
     /// The number of threads the system will use for the default thread pool
     int default_pool_concurrency =
         std::thread::hardware_concurrency() == 0 ? 2 : int(std::thread::hardware_concurrency());
+    /// If the threads of the default thread pool keep their own local queues and steal work from each other
+    bool default_pool_work_stealing = false;
 };
 
 }  // namespace NUClear
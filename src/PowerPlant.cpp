@@ -48,7 +48,7 @@ PowerPlant* PowerPlant::powerplant = nullptr;
 // This is taking argc and argv as given by main so this should not take an array
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
 PowerPlant::PowerPlant(Configuration config, int argc, const char* argv[])
-    : scheduler(config.default_pool_concurrency), logger(*this) {
+    : scheduler(config.default_pool_concurrency, config.default_pool_work_stealing), logger(*this) {
 
     // Stop people from making more then one powerplant
     if (powerplant != nullptr) {
@@ -102,6 +102,10 @@ void PowerPlant::submit(std::unique_ptr<threading::ReactionTask>&& task) noexcep
     scheduler.submit(std::move(task));
 }
 
+void PowerPlant::submit(std::vector<std::unique_ptr<threading::ReactionTask>>&& tasks) noexcept {
+    scheduler.submit(std::move(tasks));
+}
+
 void PowerPlant::shutdown(bool force) {
 
     // Emit our shutdown event
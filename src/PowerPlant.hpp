@@ -23,6 +23,7 @@
 #ifndef NUCLEAR_POWER_PLANT_HPP
 #define NUCLEAR_POWER_PLANT_HPP
 
+#include <atomic>
 #include <memory>
 #include <tuple>
 #include <type_traits>
@@ -50,6 +51,7 @@ namespace util {
 }  // namespace util
 namespace dsl {
     namespace word {
+        struct IOFinishedHandler;
         namespace emit {
             template <typename T>
             struct Local;
@@ -183,6 +185,13 @@ public:
      */
     void submit(std::unique_ptr<threading::ReactionTask>&& task) noexcept;
 
+    /**
+     * Submits several tasks at once, so each thread pool is woken once for all of its tasks.
+     *
+     * @param tasks     The Reaction tasks to be executed in the thread pools
+     */
+    void submit(std::vector<std::unique_ptr<threading::ReactionTask>>&& tasks) noexcept;
+
     /**
      * Log a message through NUClear's system.
      *
@@ -317,6 +326,8 @@ public:
     std::vector<std::unique_ptr<NUClear::Reactor>> reactors;
     /// Our logger that handles logging messages
     util::Logger logger;
+    /// The handler that IO reactions from this powerplant tell when they finish, nullptr if they emit IOFinished
+    std::atomic<dsl::word::IOFinishedHandler*> io_finished_handler{nullptr};
 };
 
 /**
@@ -62,6 +62,8 @@ namespace dsl {
 
         struct IO;
 
+        struct IORead;
+
         struct UDP;
 
         struct TCP;
@@ -131,6 +133,8 @@ namespace dsl {
             template <typename T>
             struct UDP;
             template <typename T>
+            struct UDPBatch;
+            template <typename T>
             struct Watchdog;
             template <typename WatchdogGroup, typename RuntimeType>
             struct WatchdogServicer;
@@ -226,6 +230,9 @@ protected:
     /// @copydoc dsl::word::IO
     using IO = dsl::word::IO;
 
+    /// @copydoc dsl::word::IORead
+    using IORead = dsl::word::IORead;
+
     /// @copydoc dsl::word::UDP
     using UDP = dsl::word::UDP;
 
@@ -329,6 +336,10 @@ protected:
         template <typename T>
         using UDP = dsl::word::emit::UDP<T>;
 
+        /// @copydoc dsl::word::emit::UDPBatch
+        template <typename T>
+        using UDP_BATCH = dsl::word::emit::UDPBatch<T>;
+
         /// @copydoc dsl::word::emit::WATCHDOG
         template <typename T>
         using WATCHDOG = dsl::word::emit::Watchdog<T>;
@@ -499,6 +510,7 @@ public:
 #include "dsl/word/Every.hpp"
 #include "dsl/word/Group.hpp"
 #include "dsl/word/IO.hpp"
+#include "dsl/word/IORead.hpp"
 #include "dsl/word/Idle.hpp"
 #include "dsl/word/Inline.hpp"
 #include "dsl/word/Last.hpp"
@@ -524,6 +536,7 @@ public:
 #include "dsl/word/emit/Local.hpp"
 #include "dsl/word/emit/Network.hpp"
 #include "dsl/word/emit/UDP.hpp"
+#include "dsl/word/emit/UDPBatch.hpp"
 #include "dsl/word/emit/Watchdog.hpp"
 
 #endif  // NUCLEAR_REACTOR_HPP
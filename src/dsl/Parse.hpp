@@ -47,7 +47,7 @@ namespace dsl {
                 task);
         }
 
-        static std::set<std::shared_ptr<const util::GroupDescriptor>> group(threading::ReactionTask& task) {
+        static util::GroupDescriptorSet group(threading::ReactionTask& task) {
             return std::conditional_t<fusion::has_group<DSL>::value, DSL, fusion::NoOp>::template group<
                 Parse<Sentence...>>(task);
         }
@@ -24,12 +24,13 @@
 #define NUCLEAR_DSL_FUSION_GROUP_FUSION_HPP
 
 #include <algorithm>
-#include <set>
 #include <stdexcept>
 
 #include "../../threading/Reaction.hpp"
+#include "../../util/GroupDescriptorSet.hpp"
 #include "../operation/DSLProxy.hpp"
 #include "FindWords.hpp"
+#include "TaskIndependent.hpp"
 #include "has_nuclear_dsl_method.hpp"
 
 namespace NUClear {
@@ -48,7 +49,7 @@ namespace dsl {
         struct GroupFuser<std::tuple<Word>> {
 
             template <typename DSL>
-            static std::set<std::shared_ptr<const util::GroupDescriptor>> group(threading::ReactionTask& task) {
+            static util::GroupDescriptorSet group(threading::ReactionTask& task) {
 
                 // Return our group
                 return Word::template group<DSL>(task);
@@ -60,9 +61,9 @@ namespace dsl {
         struct GroupFuser<std::tuple<Word1, Word2, WordN...>> {
 
             template <typename DSL>
-            static std::set<std::shared_ptr<const util::GroupDescriptor>> group(threading::ReactionTask& task) {
+            static util::GroupDescriptorSet group(threading::ReactionTask& task) {
                 // Merge the list of groups together
-                std::set<std::shared_ptr<const util::GroupDescriptor>> groups = Word1::template group<DSL>(task);
+                util::GroupDescriptorSet groups = Word1::template group<DSL>(task);
                 auto remainder = GroupFuser<std::tuple<Word2, WordN...>>::template group<DSL>(task);
                 groups.insert(remainder.begin(), remainder.end());
 
@@ -70,8 +71,22 @@ namespace dsl {
             }
         };
 
+        // When every group word is task independent the result is calculated once and reused for every task
+        template <typename Words, bool = all_task_independent<Words>::value>
+        struct GroupFolder : GroupFuser<Words> {};
+
+        template <typename Words>
+        struct GroupFolder<Words, true> {
+
+            template <typename DSL>
+            static util::GroupDescriptorSet group(threading::ReactionTask& task) {
+                static const auto value = GroupFuser<Words>::template group<DSL>(task);
+                return value;
+            }
+        };
+
         template <typename Word1, typename... WordN>
-        struct GroupFusion : GroupFuser<FindWords<has_group, Word1, WordN...>> {};
+        struct GroupFusion : GroupFolder<FindWords<has_group, Word1, WordN...>> {};
 
     }  // namespace fusion
 }  // namespace dsl
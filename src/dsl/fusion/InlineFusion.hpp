@@ -27,6 +27,7 @@
 #include "../../util/Inline.hpp"
 #include "../operation/DSLProxy.hpp"
 #include "FindWords.hpp"
+#include "TaskIndependent.hpp"
 #include "has_nuclear_dsl_method.hpp"
 
 namespace NUClear {
@@ -72,8 +73,22 @@ namespace dsl {
             }
         };
 
+        // When every run_inline word is task independent the result is calculated once and reused for every task
+        template <typename Words, bool = all_task_independent<Words>::value>
+        struct InlineFolder : InlineFuser<Words> {};
+
+        template <typename Words>
+        struct InlineFolder<Words, true> {
+
+            template <typename DSL>
+            static util::Inline run_inline(threading::ReactionTask& task) {
+                static const auto value = InlineFuser<Words>::template run_inline<DSL>(task);
+                return value;
+            }
+        };
+
         template <typename Word1, typename... WordN>
-        struct InlineFusion : InlineFuser<FindWords<has_run_inline, Word1, WordN...>> {};
+        struct InlineFusion : InlineFolder<FindWords<has_run_inline, Word1, WordN...>> {};
 
     }  // namespace fusion
 }  // namespace dsl
@@ -27,7 +27,7 @@
 
 #include "../../threading/Reaction.hpp"
 #include "../../threading/ReactionTask.hpp"
-#include "../../util/GroupDescriptor.hpp"
+#include "../../util/GroupDescriptorSet.hpp"
 #include "../../util/Inline.hpp"
 #include "../../util/ThreadPoolDescriptor.hpp"
 #include "../word/Pool.hpp"
@@ -54,8 +54,7 @@ namespace dsl {
             }
 
             template <typename DSL>
-            static std::set<std::shared_ptr<const util::GroupDescriptor>> group(
-                const threading::ReactionTask& /*task*/) {
+            static util::GroupDescriptorSet group(const threading::ReactionTask& /*task*/) {
                 return {};
             }
 
@@ -106,7 +105,7 @@ namespace dsl {
 
             static std::tuple<> get(threading::ReactionTask&);
 
-            static std::set<std::shared_ptr<const util::GroupDescriptor>> group(threading::ReactionTask&);
+            static util::GroupDescriptorSet group(threading::ReactionTask&);
 
             static util::Inline run_inline(threading::ReactionTask&);
 
@@ -29,6 +29,7 @@
 #include "../../threading/ReactionTask.hpp"
 #include "../operation/DSLProxy.hpp"
 #include "FindWords.hpp"
+#include "TaskIndependent.hpp"
 #include "has_nuclear_dsl_method.hpp"
 
 namespace NUClear {
@@ -64,8 +65,22 @@ namespace dsl {
             }
         };
 
+        // When every pool word is task independent the result is calculated once and reused for every task
+        template <typename Words, bool = all_task_independent<Words>::value>
+        struct PoolFolder : PoolFuser<Words> {};
+
+        template <typename Words>
+        struct PoolFolder<Words, true> {
+
+            template <typename DSL>
+            static auto pool(threading::ReactionTask& task) -> decltype(PoolFuser<Words>::template pool<DSL>(task)) {
+                static const auto value = PoolFuser<Words>::template pool<DSL>(task);
+                return value;
+            }
+        };
+
         template <typename Word1, typename... WordN>
-        struct PoolFusion : PoolFuser<FindWords<has_pool, Word1, WordN...>> {};
+        struct PoolFusion : PoolFolder<FindWords<has_pool, Word1, WordN...>> {};
 
     }  // namespace fusion
 }  // namespace dsl
@@ -26,6 +26,7 @@
 #include "../../threading/ReactionTask.hpp"
 #include "../operation/DSLProxy.hpp"
 #include "FindWords.hpp"
+#include "TaskIndependent.hpp"
 #include "has_nuclear_dsl_method.hpp"
 
 namespace NUClear {
@@ -64,8 +65,22 @@ namespace dsl {
             }
         };
 
+        // When every priority word is task independent the result is calculated once and reused for every task
+        template <typename Words, bool = all_task_independent<Words>::value>
+        struct PriorityFolder : PriorityFuser<Words> {};
+
+        template <typename Words>
+        struct PriorityFolder<Words, true> {
+
+            template <typename DSL>
+            static int priority(threading::ReactionTask& task) {
+                static const auto value = PriorityFuser<Words>::template priority<DSL>(task);
+                return value;
+            }
+        };
+
         template <typename Word1, typename... WordN>
-        struct PriorityFusion : PriorityFuser<FindWords<has_priority, Word1, WordN...>> {};
+        struct PriorityFusion : PriorityFolder<FindWords<has_priority, Word1, WordN...>> {};
 
     }  // namespace fusion
 }  // namespace dsl
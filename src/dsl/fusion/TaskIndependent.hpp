@@ -0,0 +1,77 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NUCLEAR_DSL_FUSION_TASK_INDEPENDENT_HPP
+#define NUCLEAR_DSL_FUSION_TASK_INDEPENDENT_HPP
+
+#include <tuple>
+#include <type_traits>
+
+namespace NUClear {
+namespace dsl {
+    namespace fusion {
+
+        /**
+         * Checks if a word has declared that its priority, pool, group and run_inline methods don't depend on the task.
+         *
+         * A word declares this with a `using task_independent = Word;` member that names the word itself.
+         * A word that derives from a task independent word inherits a member naming its base instead, so it is only
+         * task independent if it declares its own, as it may have replaced the methods with ones that use the task.
+         * When every word that provides one of these methods is task independent, the fused method is evaluated once
+         * for the reaction and the result is reused for every task rather than being recalculated each time.
+         *
+         * @tparam Word the word to check
+         */
+        template <typename Word>
+        struct is_task_independent {
+        private:
+            template <typename U>
+            static auto test(int) -> std::is_same<typename U::task_independent, U>;
+            template <typename>
+            static auto test(...) -> std::false_type;
+
+        public:
+            static constexpr bool value = decltype(test<Word>(0))::value;
+        };
+
+        /**
+         * Checks if a non empty list of words are all task independent.
+         *
+         * @tparam Words a tuple of the words to check
+         */
+        template <typename Words>
+        struct all_task_independent : std::false_type {};
+
+        template <typename Word>
+        struct all_task_independent<std::tuple<Word>> : std::integral_constant<bool, is_task_independent<Word>::value> {
+        };
+
+        template <typename Word1, typename Word2, typename... WordN>
+        struct all_task_independent<std::tuple<Word1, Word2, WordN...>>
+            : std::integral_constant<bool,
+                                     is_task_independent<Word1>::value
+                                         && all_task_independent<std::tuple<Word2, WordN...>>::value> {};
+
+    }  // namespace fusion
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_FUSION_TASK_INDEPENDENT_HPP
@@ -0,0 +1,69 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_OPERATION_PERIODIC_TASK_HPP
+#define NUCLEAR_DSL_OPERATION_PERIODIC_TASK_HPP
+
+#include <memory>
+#include <utility>
+
+#include "../../clock.hpp"
+
+namespace NUClear {
+namespace threading {
+    class Reaction;
+}  // namespace threading
+
+namespace dsl {
+    namespace operation {
+
+        /**
+         * Emit to have a reaction submitted at a fixed period.
+         *
+         * Rather than each reaction having its own ChronoTask, all of the reactions that share a period are run from a
+         * single timer.
+         * They fire at the same instants and their tasks are submitted together as one batch.
+         *
+         * To stop the reaction from being submitted emit an Unbind<PeriodicTask> with the id of the reaction.
+         */
+        struct PeriodicTask {
+
+            /**
+             * Constructs a new PeriodicTask.
+             *
+             * @param reaction The reaction to submit each period
+             * @param period   The time between each submission
+             */
+            PeriodicTask(std::shared_ptr<threading::Reaction> reaction, const NUClear::clock::duration& period)
+                : reaction(std::move(reaction)), period(period) {}
+
+            /// The reaction to submit each period
+            std::shared_ptr<threading::Reaction> reaction;
+            /// The time between each submission
+            NUClear::clock::duration period;
+        };
+
+    }  // namespace operation
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_OPERATION_PERIODIC_TASK_HPP
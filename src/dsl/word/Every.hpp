@@ -26,7 +26,7 @@
 #include <cmath>
 
 #include "../../threading/Reaction.hpp"
-#include "../operation/ChronoTask.hpp"
+#include "../operation/PeriodicTask.hpp"
 #include "../operation/Unbind.hpp"
 #include "emit/Inline.hpp"
 
@@ -61,6 +61,12 @@ namespace dsl {
          * For instance, to execute a callback to initialise two tasks every second, then the request would be used:
          * @code on<Every<2, Per<std::chrono::seconds>>() @endcode
          *
+         * All of the Every reactions that have the same period share a single timer, so they fire at the same
+         * instants and their tasks are submitted together.
+         * The first of them to be bound sets the phase, ticks are then spaced by the period from when it was bound.
+         * A reaction that is bound later joins at the next tick of the shared timer, so its first run may come sooner
+         * than a full period after it was bound.
+         *
          * @attention
          *  The period which is used to measure the ticks must be greater than or equal to clock::duration or the
          *  program will not compile.
@@ -85,21 +91,11 @@ namespace dsl {
             static void bind(const std::shared_ptr<threading::Reaction>& reaction, NUClear::clock::duration jump) {
 
                 reaction->unbinders.emplace_back([](const threading::Reaction& r) {
-                    r.reactor.emit<emit::Inline>(std::make_unique<operation::Unbind<operation::ChronoTask>>(r.id));
+                    r.reactor.emit<emit::Inline>(std::make_unique<operation::Unbind<operation::PeriodicTask>>(r.id));
                 });
 
                 // Send our configuration out
-                reaction->reactor.emit<emit::Inline>(std::make_unique<operation::ChronoTask>(
-                    [reaction, jump](NUClear::clock::time_point& time) {
-                        // submit the reaction to the thread pool
-                        reaction->reactor.powerplant.submit(reaction->get_task());
-
-                        time += jump;
-
-                        return true;
-                    },
-                    NUClear::clock::now() + jump,
-                    reaction->id));
+                reaction->reactor.emit<emit::Inline>(std::make_unique<operation::PeriodicTask>(reaction, jump));
             }
         };
 
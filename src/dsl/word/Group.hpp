@@ -25,6 +25,7 @@
 
 #include "../../threading/ReactionTask.hpp"
 #include "../../util/GroupDescriptor.hpp"
+#include "../../util/GroupDescriptorSet.hpp"
 #include "../../util/demangle.hpp"
 
 namespace NUClear {
@@ -64,6 +65,9 @@ namespace dsl {
         template <typename GroupType>
         struct Group {
 
+            /// The group doesn't depend on the task so it can be calculated once
+            using task_independent = Group;
+
             // This must be a separate function, otherwise each instance of DSL will be a separate pool
             static std::shared_ptr<const util::GroupDescriptor> descriptor() {
                 static const auto group_descriptor =
@@ -72,8 +76,7 @@ namespace dsl {
             }
 
             template <typename DSL>
-            static std::set<std::shared_ptr<const util::GroupDescriptor>> group(
-                const threading::ReactionTask& /*task*/) {
+            static util::GroupDescriptorSet group(const threading::ReactionTask& /*task*/) {
                 return {descriptor()};
             }
 
@@ -23,8 +23,13 @@
 #ifndef NUCLEAR_DSL_WORD_IO_HPP
 #define NUCLEAR_DSL_WORD_IO_HPP
 
+#include <atomic>
+#include <memory>
+#include <thread>
+
 #include "../../id.hpp"
 #include "../../threading/Reaction.hpp"
+#include "../../util/Epoch.hpp"
 #include "../../util/platform.hpp"
 #include "../operation/Unbind.hpp"
 #include "../store/ThreadStore.hpp"
@@ -33,6 +38,10 @@
 #include "emit/Inline.hpp"
 
 namespace NUClear {
+
+// Forward declarations
+class PowerPlant;
+
 namespace dsl {
     namespace word {
 
@@ -65,6 +74,85 @@ namespace dsl {
             NUClear::id_t id;
         };
 
+        /**
+         * An IO controller that can be told directly when a reaction has finished with its events.
+         *
+         * Emitting IOFinished goes through the whole inline emit path for every IO event.
+         * An IO controller that can re-arm a file descriptor without a message sets itself as its powerplant's handler
+         * while it exists, and IO reactions from that powerplant call it directly when they finish instead of emitting
+         * IOFinished.
+         */
+        struct IOFinishedHandler {
+            IOFinishedHandler()                                    = default;
+            virtual ~IOFinishedHandler()                           = default;
+            IOFinishedHandler(const IOFinishedHandler&)            = delete;
+            IOFinishedHandler(IOFinishedHandler&&)                 = delete;
+            IOFinishedHandler& operator=(const IOFinishedHandler&) = delete;
+            IOFinishedHandler& operator=(IOFinishedHandler&&)      = delete;
+
+            /**
+             * Called when a reaction has finished processing its IO event.
+             *
+             * @param id the id of the reaction that has finished
+             */
+            virtual void finished(const NUClear::id_t& id) = 0;
+
+            /**
+             * The handler that IO reactions from a powerplant tell when they finish.
+             *
+             * @param powerplant the powerplant the reactions belong to
+             *
+             * @return the powerplant's handler, holding nullptr when there is none and IOFinished should be emitted
+             */
+            static std::atomic<IOFinishedHandler*>& current(PowerPlant& powerplant) {
+                return powerplant.io_finished_handler;
+            }
+
+            /**
+             * Tells a powerplant's handler that one of its reactions has finished.
+             *
+             * @param powerplant the powerplant the reaction belongs to
+             * @param id         the id of the reaction that has finished
+             *
+             * @return `true` if the handler was told, otherwise IOFinished needs to be emitted
+             */
+            static bool notify(PowerPlant& powerplant, const NUClear::id_t& id) {
+                // Handlers are retired rather than deleted, so the guard keeps this one alive while we use it
+                const util::Epoch::Guard guard;
+                IOFinishedHandler* handler = current(powerplant).load(std::memory_order_seq_cst);
+                if (handler == nullptr) {
+                    return false;
+                }
+
+                // Once the handler is closed its owner may be gone, so it is only called while it is open
+                handler->active.fetch_add(1, std::memory_order_seq_cst);
+                const bool open = handler->open.load(std::memory_order_seq_cst);
+                if (open) {
+                    handler->finished(id);
+                }
+                handler->active.fetch_sub(1, std::memory_order_release);
+                return open;
+            }
+
+            /**
+             * Stops the handler from being told anything more, and waits for any reaction that is telling it now.
+             *
+             * The owner calls this before it is destroyed, and then retires the handler with util::Epoch.
+             */
+            void close() {
+                open.store(false, std::memory_order_seq_cst);
+                while (active.load(std::memory_order_acquire) != 0) {
+                    std::this_thread::yield();
+                }
+            }
+
+        private:
+            /// If the handler can still be told about reactions
+            std::atomic<bool> open{true};
+            /// The number of reactions that are telling the handler they have finished right now
+            std::atomic<int> active{0};
+        };
+
         /**
          * This is used to trigger reactions based on standard I/O operations using file descriptors.
          *
@@ -155,7 +243,9 @@ namespace dsl {
 
             template <typename DSL>
             static void post_run(threading::ReactionTask& task) {
-                task.parent->reactor.emit<emit::Inline>(std::make_unique<IOFinished>(task.parent->id));
+                if (!IOFinishedHandler::notify(task.parent->reactor.powerplant, task.parent->id)) {
+                    task.parent->reactor.emit<emit::Inline>(std::make_unique<IOFinished>(task.parent->id));
+                }
             }
         };
 
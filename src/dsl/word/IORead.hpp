@@ -0,0 +1,213 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_IO_READ_HPP
+#define NUCLEAR_DSL_WORD_IO_READ_HPP
+
+#include <cstring>
+#include <memory>
+
+#include "../../id.hpp"
+#include "../../threading/Reaction.hpp"
+#include "../../util/platform.hpp"
+#include "../operation/Unbind.hpp"
+#include "../store/ThreadStore.hpp"
+#include "IO.hpp"
+#include "emit/Inline.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        /**
+         * This message is sent to the IO controller to start reading from a file descriptor for a reaction.
+         */
+        struct IOReadConfiguration {
+            IOReadConfiguration(fd_t fd, std::shared_ptr<threading::Reaction> reaction)
+                : fd(fd), reaction(std::move(reaction)) {}
+            /// The file descriptor to read from
+            fd_t fd;
+            /// The reaction to trigger with the data that is read
+            std::shared_ptr<threading::Reaction> reaction;
+        };
+
+        /**
+         * This is used to trigger reactions with the data that has been read from a file descriptor.
+         *
+         * @code on<IORead>(file_descriptor) @endcode
+         * Rather than being told that the file descriptor is readable and having to read it itself, the reaction is
+         * given a buffer that has already been filled.
+         * Each read from a datagram socket is a single datagram, for anything else it is however much data was
+         * available, up to the size of the buffer.
+         *
+         * On Linux, when the kernel supports it, the reads are done by io_uring into a ring of buffers that is shared
+         * with the kernel.
+         * The read for the next chunk of data is already queued while the reaction runs, so there is no round trip
+         * through the IO controller before the file descriptor is read again.
+         * Otherwise the IO controller waits for the file descriptor to be readable and reads it in the same way that
+         * on<IO> would.
+         *
+         * <b>Example Use</b>
+         * @code
+         * on<IORead>(fd).then([](const IORead::Data& data) {
+         *     if (data.closed) {
+         *         // The other end has closed
+         *     }
+         *     process(data.data, data.size);
+         * });
+         * @endcode
+         *
+         * @attention
+         *  While a reaction is processing a buffer no other buffer from the same file descriptor is given to it, the
+         *  buffers are always delivered in the order they were read.
+         *  The buffer belongs to the reaction until the Data holding it is destroyed, holding on to it stops the kernel
+         *  from reading into it.
+         *
+         * @par Implements
+         *  Bind, Get, Post-run
+         */
+        struct IORead {
+
+            /// The size of the buffer each read is made into
+            static constexpr std::size_t BUFFER_SIZE = 65536;
+
+            struct Data {
+                /// The file descriptor that the data was read from
+                fd_t fd{INVALID_SOCKET};
+                /// The data that was read
+                const char* data{nullptr};
+                /// The number of bytes that were read
+                std::size_t size{0};
+                /// If the file descriptor has been closed or failed, nothing more will be read from it
+                bool closed{false};
+                /// Keeps the buffer that data points into alive, it is given back to be read into when released
+                std::shared_ptr<const void> buffer;
+
+                /// Returns true if this holds the result of a read
+                operator bool() const {
+                    return fd != INVALID_SOCKET;
+                }
+            };
+
+            using ThreadDataStore = dsl::store::ThreadStore<Data>;
+
+            /**
+             * Checks if reading nothing from a file descriptor means it has reached its end.
+             *
+             * For datagram sockets reading nothing is just an empty datagram, anything that isn't a socket is a stream.
+             *
+             * @param fd the file descriptor to check
+             *
+             * @return `true` if reading nothing means the file descriptor has ended
+             */
+            static bool is_stream(const fd_t& fd) {
+                int type            = 0;
+                socklen_t type_size = sizeof(type);
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) windows takes a char*
+                return ::getsockopt(fd, SOL_SOCKET, SO_TYPE, reinterpret_cast<char*>(&type), &type_size) != 0
+                       || type == SOCK_STREAM;
+            }
+
+            template <typename DSL>
+            static void bind(const std::shared_ptr<threading::Reaction>& reaction, fd_t fd) {
+
+                // The IO controller may have fallen back to watching the fd in the same way as on<IO> so unbind both
+                reaction->unbinders.emplace_back([](const threading::Reaction& r) {
+                    r.reactor.emit<emit::Inline>(std::make_unique<operation::Unbind<IORead>>(r.id));
+                    r.reactor.emit<emit::Inline>(std::make_unique<operation::Unbind<IO>>(r.id));
+                });
+
+                reaction->reactor.emit<emit::Inline>(std::make_unique<IOReadConfiguration>(fd, reaction));
+            }
+
+            template <typename DSL>
+            static Data get(const threading::ReactionTask& /*task*/) {
+
+                // The IO controller has already read the data for us
+                if (ThreadDataStore::value) {
+                    return *ThreadDataStore::value;
+                }
+
+                // The IO controller is watching the fd for readiness so we do the read ourselves
+                if (IO::ThreadEventStore::value) {
+                    IO::Event& event = *IO::ThreadEventStore::value;
+
+                    // Once the fd has closed it won't be watched again so everything that is left is read now
+                    const bool closing = (event.events & (IO::CLOSE | IO::ERROR)) != 0;
+
+                    // The buffer is left uninitialised as only the part that is read into is ever looked at
+                    std::size_t capacity = BUFFER_SIZE;
+                    std::unique_ptr<char[]> buffer(new char[capacity]);  // NOLINT(*-avoid-c-arrays)
+                    std::size_t size = 0;
+                    bool end         = false;
+                    do {
+                        if (capacity - size < BUFFER_SIZE) {
+                            std::unique_ptr<char[]> grown(new char[capacity * 2]);  // NOLINT(*-avoid-c-arrays)
+                            std::memcpy(grown.get(), buffer.get(), size);
+                            buffer = std::move(grown);
+                            capacity *= 2;
+                        }
+#ifdef _WIN32
+                        const int bytes = ::recv(event.fd, buffer.get() + size, int(BUFFER_SIZE), 0);
+#else
+                        const ssize_t bytes = ::read(event.fd, buffer.get() + size, BUFFER_SIZE);
+#endif
+                        size += bytes > 0 ? std::size_t(bytes) : 0;
+                        // Reading nothing is only the end for streams, a datagram socket has read an empty datagram
+                        end = (bytes == 0 && is_stream(event.fd)) || (bytes < 0 && closing);
+                        if (bytes <= 0) {
+                            break;
+                        }
+                    } while (closing);
+
+                    // Tell the IO controller the fd has ended so it stops watching it once this reaction finishes
+                    if (end) {
+                        event.events = event_t(event.events | IO::CLOSE);
+                    }
+
+                    Data data;
+                    data.fd     = event.fd;
+                    data.data   = buffer.get();
+                    data.size   = size;
+                    data.closed = end;
+                    data.buffer = std::shared_ptr<const char>(buffer.release(), std::default_delete<const char[]>());
+                    return data;
+                }
+
+                // Otherwise return invalid data
+                return Data{};
+            }
+
+            template <typename DSL>
+            static void post_run(threading::ReactionTask& task) {
+                // When the IO controller is watching for readiness this lets it watch the fd again
+                if (!IOFinishedHandler::notify(task.parent->reactor.powerplant, task.parent->id)) {
+                    task.parent->reactor.emit<emit::Inline>(std::make_unique<IOFinished>(task.parent->id));
+                }
+            }
+        };
+
+    }  // namespace word
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_IO_READ_HPP
@@ -42,6 +42,9 @@ namespace dsl {
              *  Inline
              */
             struct ALWAYS {
+                /// This doesn't depend on the task so it can be calculated once
+                using task_independent = ALWAYS;
+
                 template <typename DSL>
                 static util::Inline run_inline(const threading::ReactionTask& /*task*/) {
                     return util::Inline::ALWAYS;
@@ -58,6 +61,9 @@ namespace dsl {
              *  Inline
              */
             struct NEVER {
+                /// This doesn't depend on the task so it can be calculated once
+                using task_independent = NEVER;
+
                 template <typename DSL>
                 static util::Inline run_inline(const threading::ReactionTask& /*task*/) {
                     return util::Inline::NEVER;
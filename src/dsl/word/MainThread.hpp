@@ -46,7 +46,10 @@ namespace dsl {
          * This can be used with graphics related tasks.
          * For example, OpenGL requires all calls to be made from the main thread.
          */
-        struct MainThread : Pool<pool::Main> {};
+        struct MainThread : Pool<pool::Main> {
+            /// The main thread pool doesn't depend on the task so it can be calculated once
+            using task_independent = MainThread;
+        };
 
     }  // namespace word
 }  // namespace dsl
@@ -34,10 +34,10 @@ namespace dsl {
     namespace word {
 
         template <typename T>
-        struct NetworkData : std::shared_ptr<T> {
-            NetworkData() : std::shared_ptr<T>() {}
-            explicit NetworkData(T* ptr) : std::shared_ptr<T>(ptr) {}
-            NetworkData(const std::shared_ptr<T>& ptr) : std::shared_ptr<T>(ptr) {}
+        struct NetworkData : std::shared_ptr<const T> {
+            NetworkData() : std::shared_ptr<const T>() {}
+            explicit NetworkData(const T* ptr) : std::shared_ptr<const T>(ptr) {}
+            NetworkData(const std::shared_ptr<const T>& ptr) : std::shared_ptr<const T>(ptr) {}
         };
 
         struct NetworkSource {
@@ -47,8 +47,13 @@ namespace dsl {
         };
 
         struct NetworkListen {
+            /// Turns the bytes of a message into the type the reaction wants
+            using Deserialiser = std::shared_ptr<const void> (*)(const std::vector<uint8_t>&);
+
             uint64_t hash{0};
             std::shared_ptr<threading::Reaction> reaction{nullptr};
+            /// Reactions for the same type share a deserialiser, so each message is only deserialised once per type
+            Deserialiser deserialise{nullptr};
         };
 
         /**
@@ -59,6 +64,7 @@ namespace dsl {
          * Note that the serialization and deserialization is handled by NUClear.
          *
          * When the reaction is triggered, read-only access to T will be provided to the triggering unit via a callback.
+         * A message is deserialised once and the same T is shared by every reaction that receives it.
          *
          * @attention
          *  When using an on<Network<T>> request, the associated reaction will only be triggered when T is emitted to
@@ -83,26 +89,32 @@ namespace dsl {
                     r.reactor.emit<emit::Inline>(std::make_unique<operation::Unbind<NetworkListen>>(r.id));
                 });
 
-                task->reaction = reaction;
+                task->reaction    = reaction;
+                task->deserialise = &deserialise;
 
                 reaction->reactor.emit<emit::Inline>(task);
             }
 
             template <typename DSL>
-            static std::tuple<std::shared_ptr<NetworkSource>, NetworkData<T>> get(threading::ReactionTask& /*task*/) {
+            static std::tuple<std::shared_ptr<const NetworkSource>, NetworkData<T>> get(
+                threading::ReactionTask& /*task*/) {
 
-                const auto* data   = store::ThreadStore<const std::vector<uint8_t>>::value;
-                const auto* source = store::ThreadStore<const NetworkSource>::value;
+                const auto* data   = store::ThreadStore<const std::shared_ptr<const void>>::value;
+                const auto* source = store::ThreadStore<const std::shared_ptr<const NetworkSource>>::value;
 
                 if (data && source) {
 
-                    // Return our deserialised data
-                    return std::make_tuple(std::make_shared<NetworkSource>(*source),
-                                           std::make_shared<T>(util::serialise::Serialise<T>::deserialise(*data)));
+                    // Return the data the network controller deserialised for us
+                    return std::make_tuple(*source, NetworkData<T>(std::static_pointer_cast<const T>(*data)));
                 }
 
                 // Return invalid data
-                return std::make_tuple(std::shared_ptr<NetworkSource>(nullptr), NetworkData<T>(nullptr));
+                return std::make_tuple(std::shared_ptr<const NetworkSource>(nullptr), NetworkData<T>(nullptr));
+            }
+
+        private:
+            static std::shared_ptr<const void> deserialise(const std::vector<uint8_t>& payload) {
+                return std::make_shared<T>(util::serialise::Serialise<T>::deserialise(payload));
             }
         };
 
@@ -114,7 +126,7 @@ namespace dsl {
         struct is_transient<typename word::NetworkData<T>> : std::true_type {};
 
         template <>
-        struct is_transient<typename std::shared_ptr<word::NetworkSource>> : std::true_type {};
+        struct is_transient<typename std::shared_ptr<const word::NetworkSource>> : std::true_type {};
 
     }  // namespace trait
 }  // namespace dsl
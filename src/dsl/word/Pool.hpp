@@ -73,17 +73,24 @@ namespace dsl {
          *      static constexpr int concurrency = 2;
          *  };
          *  @endcode
+         *                  It may also set `static constexpr bool work_stealing = true;` to give each thread its own
+         *                  local queues, so tasks submitted from a pool thread stay on that thread unless an idle
+         *                  peer steals them.
          */
         template <typename PoolType = pool::Default>
         struct Pool {
 
+            /// The pool doesn't depend on the task so it can be calculated once
+            using task_independent = Pool;
+
             // This must be a separate function, otherwise each instance of DSL will be a separate pool
             static std::shared_ptr<const util::ThreadPoolDescriptor> descriptor() {
                 static const auto pool_descriptor =
                     std::make_shared<const util::ThreadPoolDescriptor>(name<PoolType>(),
                                                                        concurrency<PoolType>(),
                                                                        counts_for_idle<PoolType>(),
-                                                                       persistent<PoolType>());
+                                                                       persistent<PoolType>(),
+                                                                       work_stealing<PoolType>());
                 return pool_descriptor;
             }
 
@@ -125,6 +132,15 @@ namespace dsl {
             static constexpr bool persistent(const A&... /*unused*/) {
                 return false;
             }
+
+            template <typename U>
+            static constexpr auto work_stealing() -> decltype(U::work_stealing) {
+                return U::work_stealing;
+            }
+            template <typename U, typename... A>
+            static constexpr bool work_stealing(const A&... /*unused*/) {
+                return false;
+            }
         };
 
     }  // namespace word
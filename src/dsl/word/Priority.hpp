@@ -72,6 +72,8 @@ namespace dsl {
             struct REALTIME {
                 /// Realtime priority runs with 1000 value
                 static constexpr int value = 1000;
+                /// The priority doesn't depend on the task so it can be calculated once
+                using task_independent = REALTIME;
 
                 template <typename DSL>
                 static int priority(const threading::ReactionTask& /*task*/) {
@@ -82,6 +84,8 @@ namespace dsl {
             struct HIGH {
                 /// High priority runs with 750 value
                 static constexpr int value = 750;
+                /// The priority doesn't depend on the task so it can be calculated once
+                using task_independent = HIGH;
 
                 template <typename DSL>
                 static int priority(const threading::ReactionTask& /*task*/) {
@@ -92,6 +96,8 @@ namespace dsl {
             struct NORMAL {
                 /// Normal priority runs with 500 value
                 static constexpr int value = 500;
+                /// The priority doesn't depend on the task so it can be calculated once
+                using task_independent = NORMAL;
 
                 template <typename DSL>
                 static int priority(const threading::ReactionTask& /*task*/) {
@@ -102,6 +108,8 @@ namespace dsl {
             struct LOW {
                 /// Low priority runs with 250 value
                 static constexpr int value = 250;
+                /// The priority doesn't depend on the task so it can be calculated once
+                using task_independent = LOW;
 
                 template <typename DSL>
                 static int priority(const threading::ReactionTask& /*task*/) {
@@ -112,6 +120,8 @@ namespace dsl {
             struct IDLE {
                 /// Idle tasks run with 0 priority, they run when there is free time
                 static constexpr int value = 0;
+                /// The priority doesn't depend on the task so it can be calculated once
+                using task_independent = IDLE;
 
                 template <typename DSL>
                 static int priority(const threading::ReactionTask& /*task*/) {
@@ -68,7 +68,10 @@ namespace dsl {
          *                   system, to act as a group reference.
          */
         template <typename SyncGroup>
-        struct Sync : Group<SyncGroup> {};
+        struct Sync : Group<SyncGroup> {
+            /// The group doesn't depend on the task so it can be calculated once
+            using task_independent = Sync;
+        };
 
     }  // namespace word
 }  // namespace dsl
@@ -23,13 +23,15 @@
 #ifndef NUCLEAR_DSL_WORD_UDP_HPP
 #define NUCLEAR_DSL_WORD_UDP_HPP
 
+#include <algorithm>
 #include <array>
 #include <stdexcept>
 
 #include "../../threading/Reaction.hpp"
 #include "../../util/FileDescriptor.hpp"
-#include "../../util/network/get_interfaces.hpp"
+#include "../../util/network/cached_interfaces.hpp"
 #include "../../util/network/if_number_from_address.hpp"
+#include "../../util/network/recv_datagrams.hpp"
 #include "../../util/network/resolve.hpp"
 #include "../../util/platform.hpp"
 #include "IO.hpp"
@@ -58,6 +60,12 @@ namespace dsl {
          * on<UDP:Multicast>(multicast_address, port) @endcode
          * If needed, this trigger can also listen for UDP activity such as broadcast and multicast.
          *
+         * @code on<UDP::Batch>(port, bind_address) @endcode
+         * Receives every packet that is waiting on the socket each time it becomes readable, up to
+         * util::network::MAX_DATAGRAMS at a time, and gives them to the reaction together as UDP::Batch::Packets.
+         * The payloads are not copied out of the memory they were received into, so a busy socket does not create a
+         * task or allocate for every packet.
+         *
          * These requests support both IPv4 and IPv6 addressing.
          *
          * @par Implements
@@ -95,6 +103,37 @@ namespace dsl {
                 util::network::sock_t remote{};
             };
 
+            /**
+             * Checks if an address is the address of one of the interfaces in a snapshot.
+             *
+             * @param interfaces the interfaces to check against
+             * @param local      the address the packet was sent to
+             *
+             * @return `true` if it is one of our local addresses
+             */
+            static bool is_local(const util::network::InterfaceSnapshot& interfaces,
+                                 const util::network::sock_t& local) {
+                for (const auto& iface : interfaces) {
+                    if (iface.ip.sock.sa_family == local.sock.sa_family) {
+                        // If the two are equal
+                        if (iface.ip.sock.sa_family == AF_INET) {
+                            if (iface.ip.ipv4.sin_addr.s_addr == local.ipv4.sin_addr.s_addr) {
+                                return true;
+                            }
+                        }
+                        else if (iface.ip.sock.sa_family == AF_INET6) {
+                            if (std::memcmp(&iface.ip.ipv6.sin6_addr,
+                                            &local.ipv6.sin6_addr,
+                                            sizeof(local.ipv6.sin6_addr))
+                                == 0) {
+                                return true;
+                            }
+                        }
+                    }
+                }
+                return false;
+            }
+
         public:
             struct Packet {
                 Packet() = default;
@@ -410,24 +449,14 @@ namespace dsl {
                 p.local   = result.local;
                 p.remote  = result.remote;
 
-                // Confirm that this packet was sent to one of our local addresses
-                for (const auto& iface : util::network::get_interfaces()) {
-                    if (iface.ip.sock.sa_family == result.local.sock.sa_family) {
-                        // If the two are equal
-                        if (iface.ip.sock.sa_family == AF_INET) {
-                            if (iface.ip.ipv4.sin_addr.s_addr == result.local.ipv4.sin_addr.s_addr) {
-                                return p;
-                            }
-                        }
-                        else if (iface.ip.sock.sa_family == AF_INET6) {
-                            if (std::memcmp(&iface.ip.ipv6.sin6_addr,
-                                            &result.local.ipv6.sin6_addr,
-                                            sizeof(result.local.ipv6.sin6_addr))
-                                == 0) {
-                                return p;
-                            }
-                        }
-                    }
+                // Confirm that this packet was sent to one of our local addresses, an address that isn't in the cached
+                // interfaces may have only just been added so check again before dropping the packet
+                if (is_local(util::network::cached_interfaces(), result.local)) {
+                    return p;
+                }
+                util::network::refresh_interfaces(result.local);
+                if (is_local(util::network::cached_interfaces(), result.local)) {
+                    return p;
                 }
 
                 return {};
@@ -462,18 +491,35 @@ namespace dsl {
                         }
 
                         // Confirm that this packet was sent to one of our broadcast addresses
-                        for (const auto& iface : util::network::get_interfaces()) {
-                            if (iface.broadcast.sock.sa_family == AF_INET) {
-                                if (iface.flags.broadcast
-                                    && iface.broadcast.ipv4.sin_addr.s_addr == result.local.ipv4.sin_addr.s_addr) {
-                                    return p;
-                                }
-                            }
+                        if (is_broadcast(result.local)) {
+                            return p;
+                        }
+                        util::network::refresh_interfaces(result.local);
+                        if (is_broadcast(result.local)) {
+                            return p;
                         }
                     }
 
                     return {};
                 }
+
+            private:
+                /**
+                 * Checks if an address is the broadcast address of one of the cached interfaces.
+                 *
+                 * @param local the address the packet was sent to
+                 *
+                 * @return `true` if it is one of our broadcast addresses
+                 */
+                static bool is_broadcast(const util::network::sock_t& local) {
+                    for (const auto& iface : util::network::cached_interfaces()) {
+                        if (iface.broadcast.sock.sa_family == AF_INET && iface.flags.broadcast
+                            && iface.broadcast.ipv4.sin_addr.s_addr == local.ipv4.sin_addr.s_addr) {
+                            return true;
+                        }
+                    }
+                    return false;
+                }
             };
 
             struct Multicast : IO {
@@ -510,6 +556,97 @@ namespace dsl {
                     return {};
                 }
             };
+
+            struct Batch : IO {
+
+                /// A packet in a batch, its payload points into memory that is held by the batch
+                using Packet = util::network::Datagram;
+
+                /**
+                 * The packets that were waiting on the socket when the reaction was woken.
+                 */
+                struct Packets {
+                    /// The packets in the order they were received
+                    std::vector<Packet> packets;
+                    /// Keeps the payloads alive, the memory is reused for later batches once every copy is released
+                    std::shared_ptr<const void> buffer;
+
+                    const Packet* begin() const {
+                        return packets.data();
+                    }
+                    const Packet* end() const {
+                        return packets.data() + packets.size();
+                    }
+                    std::size_t size() const {
+                        return packets.size();
+                    }
+                    bool empty() const {
+                        return packets.empty();
+                    }
+
+                    /**
+                     * Casts this batch to a boolean to check if it has any packets
+                     *
+                     * @return true if the batch has packets
+                     */
+                    operator bool() const {
+                        return !packets.empty();
+                    }
+                };
+
+                template <typename DSL>
+                static std::tuple<in_port_t, fd_t> bind(const std::shared_ptr<threading::Reaction>& reaction,
+                                                        const in_port_t& port           = 0,
+                                                        const std::string& bind_address = "") {
+                    return UDP::connect<DSL>(reaction,
+                                             ConnectOptions{ConnectOptions::Type::UNICAST, bind_address, port, ""});
+                }
+
+                template <typename DSL>
+                static Packets get(threading::ReactionTask& task) {
+                    auto event = IO::get<DSL>(task);
+
+                    // If our get is being run without an fd (something else triggered)
+                    // Or if the event is not a read event then short circuit
+                    if (!event || (event.events & IO::READ) != IO::READ) {
+                        return {};
+                    }
+
+                    util::network::DatagramBatch batch = util::network::recv_datagrams(event.fd);
+
+                    Packets p{};
+                    p.packets = std::move(batch.datagrams);
+                    p.buffer  = std::move(batch.buffer);
+
+                    // Confirm that every packet was sent to one of our local addresses
+                    std::vector<util::network::sock_t> missing;
+                    {
+                        const auto interfaces = util::network::cached_interfaces();
+                        for (const auto& packet : p.packets) {
+                            if (!is_local(interfaces, packet.local)) {
+                                missing.push_back(packet.local);
+                            }
+                        }
+                    }
+
+                    // An address that isn't in the cached interfaces may have only just been added so check again
+                    // before dropping the packets that were sent to it
+                    if (!missing.empty()) {
+                        for (const auto& address : missing) {
+                            util::network::refresh_interfaces(address);
+                        }
+                        const auto interfaces = util::network::cached_interfaces();
+                        p.packets.erase(std::remove_if(p.packets.begin(),
+                                                       p.packets.end(),
+                                                       [&interfaces](const Packet& packet) {
+                                                           return !is_local(interfaces, packet.local);
+                                                       }),
+                                        p.packets.end());
+                    }
+
+                    return p;
+                }
+            };
         };
 
     }  // namespace word
@@ -62,9 +62,7 @@ namespace dsl {
                         [](threading::ReactionTask& /*task*/) { return 1000; },
                         [](threading::ReactionTask& /*task*/) { return util::Inline::NEVER; },
                         [](threading::ReactionTask& /*task*/) { return Pool<>::descriptor(); },
-                        [](threading::ReactionTask& /*task*/) {
-                            return std::set<std::shared_ptr<const util::GroupDescriptor>>{};
-                        });
+                        [](threading::ReactionTask& /*task*/) { return util::GroupDescriptorSet{}; });
                     emitter->callback = [&powerplant, data](threading::ReactionTask& /*task*/) {
                         powerplant.emit_shared<dsl::word::emit::Local>(data);
                     };
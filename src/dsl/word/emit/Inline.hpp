@@ -23,6 +23,8 @@
 #ifndef NUCLEAR_DSL_WORD_EMIT_INLINE_HPP
 #define NUCLEAR_DSL_WORD_EMIT_INLINE_HPP
 
+#include <memory>
+
 #include "../../../PowerPlant.hpp"
 #include "../../store/DataStore.hpp"
 #include "../../store/ThreadStore.hpp"
@@ -57,11 +59,17 @@ namespace dsl {
 
                 static void emit(PowerPlant& powerplant, std::shared_ptr<DataType> data) {
 
+                    // Share the list rather than holding a snapshot, as these tasks run on this thread before we
+                    // return and a snapshot would stop retired data being freed until they finish
+                    const auto reactions = store::TypeCallbackStore<DataType>::share();
+
                     // Run all our reactions that are interested
-                    for (auto& reaction : store::TypeCallbackStore<DataType>::get()) {
-                        // Set our thread local store data each time (as during inline it can be overwritten)
-                        store::ThreadStore<std::shared_ptr<DataType>>::value = &data;
-                        powerplant.submit(reaction->get_task(true));
+                    if (reactions != nullptr) {
+                        for (const auto& reaction : *reactions) {
+                            // Set our thread local store data each time (as during inline it can be overwritten)
+                            store::ThreadStore<std::shared_ptr<DataType>>::value = &data;
+                            powerplant.submit(reaction->get_task(true));
+                        }
                     }
 
                     // Unset our thread local store data
@@ -23,6 +23,9 @@
 #ifndef NUCLEAR_DSL_WORD_EMIT_LOCAL_HPP
 #define NUCLEAR_DSL_WORD_EMIT_LOCAL_HPP
 
+#include <memory>
+#include <vector>
+
 #include "../../../PowerPlant.hpp"
 #include "../../../util/TypeMap.hpp"
 #include "../../store/DataStore.hpp"
@@ -52,16 +55,38 @@ namespace dsl {
 
                 static void emit(PowerPlant& powerplant, std::shared_ptr<DataType> data) {
 
-                    // Run all our reactions that are interested
-                    for (auto& reaction : store::TypeCallbackStore<DataType>::get()) {
+                    std::unique_ptr<threading::ReactionTask> task;
+                    std::vector<std::unique_ptr<threading::ReactionTask>> tasks;
+
+                    // Make the tasks while we hold the snapshot but only submit them once it has been released.
+                    // Tasks can run inline when they are submitted, and while a snapshot is held no retired data can
+                    // be freed.
+                    {
+                        const auto reactions = store::TypeCallbackStore<DataType>::get();
 
                         // Set our thread local store data
                         store::ThreadStore<std::shared_ptr<DataType>>::value = &data;
-                        powerplant.submit(reaction->get_task());
+
+                        if (reactions.size() == 1) {
+                            task = (*reactions.begin())->get_task();
+                        }
+                        // With several reactions make all the tasks first so each pool only has to be woken once
+                        else if (reactions.size() > 1) {
+                            tasks.reserve(reactions.size());
+                            for (const auto& reaction : reactions) {
+                                tasks.push_back(reaction->get_task());
+                            }
+                        }
+
+                        // Unset our thread local store data
+                        store::ThreadStore<std::shared_ptr<DataType>>::value = nullptr;
                     }
 
-                    // Unset our thread local store data
-                    store::ThreadStore<std::shared_ptr<DataType>>::value = nullptr;
+                    // Run all our reactions that are interested
+                    powerplant.submit(std::move(task));
+                    if (!tasks.empty()) {
+                        powerplant.submit(std::move(tasks));
+                    }
 
                     // Set the data into the global store
                     store::DataStore<DataType>::set(data);
@@ -24,7 +24,9 @@
 #define NUCLEAR_DSL_WORD_EMIT_NETWORK_HPP
 
 #include <array>
+#include <memory>
 #include <utility>
+#include <vector>
 
 #include "../../../util/serialise/Serialise.hpp"
 
@@ -39,8 +41,8 @@ namespace dsl {
                 std::string target;
                 /// The hash identifying the type of object
                 uint64_t hash{0};
-                /// The serialised data
-                std::vector<uint8_t> payload;
+                /// The serialised data, shared and never modified so it can be held for retransmission without a copy
+                std::shared_ptr<const std::vector<uint8_t>> payload;
                 /// If the message should be sent reliably
                 bool reliable{false};
             };
@@ -88,7 +90,8 @@ namespace dsl {
 
                     e->target   = std::move(target);
                     e->hash     = util::serialise::Serialise<DataType>::hash();
-                    e->payload  = util::serialise::Serialise<DataType>::serialise(*data);
+                    e->payload  = std::make_shared<const std::vector<uint8_t>>(
+                        util::serialise::Serialise<DataType>::serialise(*data));
                     e->reliable = reliable;
 
                     powerplant.emit<Inline>(e);
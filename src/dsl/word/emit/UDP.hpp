@@ -26,8 +26,8 @@
 #include <stdexcept>
 
 #include "../../../PowerPlant.hpp"
-#include "../../../util/FileDescriptor.hpp"
-#include "../../../util/network/if_number_from_address.hpp"
+#include "../../../util/network/resolve.hpp"
+#include "../../../util/network/udp_sender.hpp"
 #include "../../../util/platform.hpp"
 #include "../../../util/serialise/Serialise.hpp"
 #include "../../store/DataStore.hpp"
@@ -45,6 +45,8 @@ namespace dsl {
              * Emissions under this scope are useful for communicating with other systems using UDP.
              * The target of the packet can be can be a unicast, broadcast or multicast address, specified as a string.
              * Additionally the address and port on the local machine can be specified using a string and port.
+             * Unless a specific local port is given the packet is sent from a socket that is kept open and reused by
+             * later emissions with the same settings.
              *
              * @attention
              *  Anything emitted over the UDP network must be serialisable.
@@ -67,124 +69,13 @@ namespace dsl {
                                  in_port_t from_port          = 0) {
 
                     // Resolve our addresses
-                    const util::network::sock_t remote = util::network::resolve(to_addr, to_port);
-                    const bool multicast =
-                        remote.sock.sa_family == AF_INET    ? ((remote.ipv4.sin_addr.s_addr >> 28) == 0xE)
-                        : remote.sock.sa_family == AF_INET6 ? ((remote.ipv6.sin6_addr.s6_addr[0] & 0xFF) == 0xFF)
-                                                            : false;
-
-                    // If we are not provided a from address, use any from address
-                    util::network::sock_t local{};
-                    if (from_addr.empty()) {
-                        // By default have the settings of local match remote (except address and port)
-                        local = remote;
-                        switch (local.sock.sa_family) {
-                            case AF_INET: {
-                                local.ipv4.sin_port        = htons(from_port);
-                                local.ipv4.sin_addr.s_addr = htonl(INADDR_ANY);
-                            } break;
-                            case AF_INET6: {
-                                local.ipv6.sin6_port = htons(from_port);
-                                local.ipv6.sin6_addr = IN6ADDR_ANY_INIT;
-                            } break;
-                            default: throw std::invalid_argument("Unknown socket family");
-                        }
-                    }
-                    else {
-                        local = util::network::resolve(from_addr, from_port);
-                        if (local.sock.sa_family != remote.sock.sa_family) {
-                            throw std::invalid_argument("to and from addresses are not the same family");
-                        }
-                    }
-
-                    // Open a socket to send the datagram from
-                    util::FileDescriptor fd = ::socket(local.sock.sa_family, SOCK_DGRAM, IPPROTO_UDP);
-                    if (!fd.valid()) {
-                        throw std::system_error(network_errno, std::system_category(), "Unable to open the UDP socket");
-                    }
-
-                    int yes = 1;
-                    // Set reuse address and port so that emit can use the same port multiple times
-                    if (::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&yes), sizeof(yes))
-                        < 0) {
-                        throw std::system_error(network_errno,
-                                                std::system_category(),
-                                                "Unable to set the reuse address option on the UDP socket");
-                    }
-#ifdef SO_REUSEPORT
-                    // If SO_REUSEPORT is available set it too
-                    if (::setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, reinterpret_cast<const char*>(&yes), sizeof(yes))
-                        < 0) {
-                        throw std::system_error(network_errno,
-                                                std::system_category(),
-                                                "Unable to set the reuse port option on the UDP socket");
-                    }
-#endif
-
-                    // If we are using multicast and we have a specific from_addr we need to tell the system to use the
-                    // correct interface
-                    if (multicast && !from_addr.empty()) {
-                        if (local.sock.sa_family == AF_INET) {
-                            // Set our transmission interface for the multicast socket
-                            if (::setsockopt(fd,
-                                             IPPROTO_IP,
-                                             IP_MULTICAST_IF,
-                                             reinterpret_cast<const char*>(&local.ipv4.sin_addr),
-                                             sizeof(local.ipv4.sin_addr))
-                                < 0) {
-                                throw std::system_error(network_errno,
-                                                        std::system_category(),
-                                                        "Unable to use the requested interface for multicast");
-                            }
-                        }
-                        else if (local.sock.sa_family == AF_INET6) {
-                            // Set our transmission interface for the multicast socket
-                            auto if_number = util::network::if_number_from_address(local.ipv6);
-                            if (::setsockopt(fd,
-                                             IPPROTO_IPV6,
-                                             IPV6_MULTICAST_IF,
-                                             reinterpret_cast<const char*>(&if_number),
-                                             sizeof(if_number))
-                                < 0) {
-                                throw std::system_error(network_errno,
-                                                        std::system_category(),
-                                                        "Unable to use the requested interface for multicast");
-                            }
-                        }
-                    }
-
-                    // Bind a local port if requested
-                    if (!from_addr.empty() || from_port != 0) {
-                        if (::bind(fd, &local.sock, local.size()) != 0) {
-                            throw std::system_error(network_errno,
-                                                    std::system_category(),
-                                                    "Unable to bind the UDP socket to the port");
-                        }
-                    }
-
-                    // Assume that if the user is sending a broadcast they want to enable broadcasting
-                    if (::setsockopt(fd, SOL_SOCKET, SO_BROADCAST, reinterpret_cast<const char*>(&yes), sizeof(yes))
-                        < 0) {
-                        throw std::system_error(network_errno,
-                                                std::system_category(),
-                                                "Unable to enable broadcasting on this socket");
-                    }
+                    const util::network::sock_t remote = util::network::resolve_cached(to_addr, to_port);
 
                     // Serialise to our payload
                     std::vector<uint8_t> payload = util::serialise::Serialise<DataType>::serialise(*data);
 
-                    // Try to send our payload
-                    if (::sendto(fd,
-                                 reinterpret_cast<const char*>(payload.data()),
-                                 static_cast<socklen_t>(payload.size()),
-                                 0,
-                                 &remote.sock,
-                                 remote.size())
-                        < 0) {
-                        throw std::system_error(network_errno,
-                                                std::system_category(),
-                                                "Unable to send the UDP message");
-                    }
+                    // Send it from a socket that is kept open for packets with the same settings
+                    util::network::udp_sender(remote, from_addr, from_port)->send(payload, remote);
                 }
             };
 
@@ -0,0 +1,83 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_EMIT_UDP_BATCH_HPP
+#define NUCLEAR_DSL_WORD_EMIT_UDP_BATCH_HPP
+
+#include "../../../PowerPlant.hpp"
+#include "../../../util/network/resolve.hpp"
+#include "../../../util/network/udp_sender.hpp"
+#include "../../../util/platform.hpp"
+#include "../../../util/serialise/Serialise.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+        namespace emit {
+
+            /**
+             * Emits data as a UDP packet over the network, sending it together with packets emitted at the same time.
+             *
+             * @code emit<Scope::UDP_BATCH>(data, to_addr, to_port); @endcode
+             * This takes the same arguments as emit<Scope::UDP> and sends from the same sockets.
+             * If another thread is already sending from the socket the packet is queued for that thread, which sends
+             * everything that is queued while it works in as few sendmmsg calls as it can, and the emit returns
+             * straight away.
+             * This suits sending many small packets, such as telemetry, from several threads at once.
+             *
+             * @attention
+             *  Anything emitted over the UDP network must be serialisable.
+             *  As the packet can be sent by another thread a failure to send it is not reported, errors opening the
+             *  socket or resolving the addresses are still thrown.
+             *
+             * @param data      the data to emit
+             * @param to_addr   a string specifying the address to send this packet to
+             * @param to_port   the port to send this packet to in host endian
+             * @param from_addr Optional. The address to send this from or "" to automatically choose an address.
+             * @param from_port Optional. The port to send this from in host endian or 0 to automatically choose a port.
+             * @tparam DataType the datatype of the object to emit
+             */
+            template <typename DataType>
+            struct UDPBatch {
+
+                static void emit(const PowerPlant& /*powerplant*/,
+                                 const std::shared_ptr<DataType>& data,
+                                 const std::string& to_addr,
+                                 in_port_t to_port,
+                                 const std::string& from_addr = "",
+                                 in_port_t from_port          = 0) {
+
+                    // Resolve our addresses
+                    const util::network::sock_t remote = util::network::resolve_cached(to_addr, to_port);
+
+                    // Serialise to our payload and queue it on the socket
+                    util::network::udp_sender(remote, from_addr, from_port)
+                        ->queue(util::serialise::Serialise<DataType>::serialise(*data), remote);
+                }
+            };
+
+        }  // namespace emit
+    }  // namespace word
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_EMIT_UDP_BATCH_HPP
@@ -28,10 +28,13 @@
 #include <memory>
 #include <mutex>
 #include <utility>
+#include <vector>
 
 #include "../Reactor.hpp"
 #include "../dsl/operation/Unbind.hpp"
 #include "../message/TimeTravel.hpp"
+#include "../threading/Reaction.hpp"
+#include "../threading/ReactionTask.hpp"
 #include "../util/precise_sleep.hpp"
 
 namespace NUClear {
@@ -40,8 +43,8 @@ namespace extension {
     ChronoController::ChronoController(std::unique_ptr<NUClear::Environment> environment)
         : Reactor(std::move(environment)) {
 
-        // Estimate the accuracy of our cv wait and precise sleep
-        for (int i = 0; i < 3; ++i) {
+        // Estimate the accuracy of our cv wait and precise sleep, these are only used without a kernel timer
+        for (int i = 0; !timer.valid() && i < 3; ++i) {
             // Estimate the accuracy of our cv wait
             std::mutex test;
             std::unique_lock<std::mutex> lock(test);
@@ -67,12 +70,11 @@ namespace extension {
 
             // Add our new task to the heap if we are still running
             if (running.load(std::memory_order_acquire)) {
-                tasks.push_back(*task);
-                std::push_heap(tasks.begin(), tasks.end(), std::greater<>());
+                tasks.insert(task->id, task->time, task->task);
             }
 
             // Poke the system
-            wait.notify_all();
+            poke();
         });
 
         on<Trigger<dsl::operation::Unbind<ChronoTask>>>().then(
@@ -81,26 +83,70 @@ namespace extension {
                 // Lock the mutex while we're doing stuff
                 const std::lock_guard<std::mutex> lock(mutex);
 
-                // Find the task
-                auto it = std::find_if(tasks.begin(), tasks.end(), [&](const ChronoTask& task) {
-                    return task.id == unbind.id;
-                });
-
-                // Remove if it exists
-                if (it != tasks.end()) {
-                    tasks.erase(it);
-                    std::make_heap(tasks.begin(), tasks.end(), std::greater<>());
-                }
+                // Remove the task if it exists
+                tasks.cancel(unbind.id);
 
                 // Poke the system to make sure it's not waiting on something that's gone
-                wait.notify_all();
+                poke();
+            });
+
+        on<Trigger<PeriodicTask>>().then("Add Periodic task", [this](const std::shared_ptr<const PeriodicTask>& task) {
+            const std::lock_guard<std::mutex> lock(mutex);
+
+            if (!running.load(std::memory_order_acquire)) {
+                return;
+            }
+
+            // Join the timer for this period if there is one so we stay in phase with the reactions already on it
+            auto it = periods.find(task->period);
+            if (it != periods.end()) {
+                it->second.push_back(task->reaction);
+            }
+            else {
+                periods[task->period].push_back(task->reaction);
+
+                // Our ID is -1 as the timer removes itself once it has no reactions left
+                tasks.insert(-1,
+                             NUClear::clock::now() + task->period,
+                             [this, period = task->period](NUClear::clock::time_point& time) {
+                                 return run_period(period, time);
+                             });
+                poke();
+            }
+        });
+
+        on<Trigger<dsl::operation::Unbind<PeriodicTask>>>().then(
+            "Unbind Periodic Task",
+            [this](const dsl::operation::Unbind<PeriodicTask>& unbind) {
+                const std::lock_guard<std::mutex> lock(mutex);
+
+                // The timer is left to remove itself when it next fires if this was the last reaction on it
+                for (auto& period : periods) {
+                    auto& reactions = period.second;
+                    reactions.erase(std::remove_if(reactions.begin(),
+                                                   reactions.end(),
+                                                   [&](const std::shared_ptr<threading::Reaction>& reaction) {
+                                                       return reaction->id == unbind.id;
+                                                   }),
+                                    reactions.end());
+                }
             });
 
         // When we shutdown we notify so we quit now
         on<Shutdown>().then("Shutdown Chrono Controller", [this] {
             running.store(false, std::memory_order_release);
             const std::lock_guard<std::mutex> lock(mutex);
-            wait.notify_all();
+            poke();
+
+            if (timer_wakeups > 0) {
+                log<DEBUG>("Chrono timer wakeups were late by",
+                           std::chrono::duration_cast<std::chrono::microseconds>(timer_jitter).count(),
+                           "us on average and",
+                           std::chrono::duration_cast<std::chrono::microseconds>(timer_jitter_max).count(),
+                           "us at most over",
+                           timer_wakeups,
+                           "wakeups");
+            }
         });
 
         on<Trigger<message::TimeTravel>>().then("Time Travel", [this](const message::TimeTravel& travel) {
@@ -112,24 +158,28 @@ namespace extension {
                 case message::TimeTravel::Action::RELATIVE: {
                     auto adjustment = travel.target - NUClear::clock::now();
                     clock::set_clock(travel.target, travel.rtf);
-                    for (auto& task : tasks) {
-                        task.time += adjustment;
-                    }
-
+                    tasks.shift(adjustment);
                 } break;
                 case message::TimeTravel::Action::NEAREST: {
                     const clock::time_point nearest =
-                        tasks.empty() ? travel.target
-                                      : std::min(travel.target, std::min_element(tasks.begin(), tasks.end())->time);
+                        tasks.empty() ? travel.target : std::min(travel.target, tasks.next());
                     clock::set_clock(nearest, travel.rtf);
                 } break;
             }
 
+            // If the clock went backwards make sure the tasks are still ordered around the new time
+            tasks.rewind(NUClear::clock::now());
+
             // Poke the system
-            wait.notify_all();
+            poke();
         });
 
         on<Always, Priority::REALTIME>().then("Chrono Controller", [this] {
+            // Let the kernel wake us as close to the deadline as it can
+            if (timer.valid()) {
+                util::TimerFD::minimise_timer_slack();
+            }
+
             // Run until we are told to stop
             while (running.load(std::memory_order_acquire)) {
 
@@ -138,26 +188,24 @@ namespace extension {
 
                 // If we have no chrono tasks wait until we are notified
                 if (tasks.empty()) {
-                    wait.wait(lock, [this] { return !running.load(std::memory_order_acquire) || !tasks.empty(); });
+                    if (timer.valid()) {
+                        // A poke between unlocking and waiting is kept by the timer so it can't be missed
+                        lock.unlock();
+                        timer.wait();
+                    }
+                    else {
+                        wait.wait(lock, [this] { return !running.load(std::memory_order_acquire) || !tasks.empty(); });
+                    }
                 }
                 else {
                     auto start  = NUClear::clock::now();
-                    auto target = tasks.front().time;
+                    auto target = tasks.next();
 
                     if (target <= start) {
-                        // Run our task and if it returns false remove it
-                        const bool renew = tasks.front()();
-
-                        // Move this to the back of the list
-                        std::pop_heap(tasks.begin(), tasks.end(), std::greater<>());
-
-                        if (renew) {
-                            // Put the item back in the list
-                            std::push_heap(tasks.begin(), tasks.end(), std::greater<>());
-                        }
-                        else {
-                            // Remove the item from the list
-                            tasks.pop_back();
+                        // Run our task and if it returns true put it back in with its new time
+                        auto task = tasks.pop();
+                        if (task.value(task.time)) {
+                            tasks.insert(task.id, task.time, std::move(task.value));
                         }
                     }
                     else {
@@ -166,7 +214,27 @@ namespace extension {
 
                         if (clock::rtf() == 0.0) {
                             // If we are paused then just wait until we are unpaused
-                            wait.wait(lock);
+                            if (timer.valid()) {
+                                lock.unlock();
+                                timer.wait();
+                            }
+                            else {
+                                wait.wait(lock);
+                            }
+                        }
+                        else if (timer.valid()) {
+                            // Sleep on the kernel timer until the task is due or we are poked
+                            lock.unlock();
+                            timer.wait_for(time_until_task);
+                            lock.lock();
+
+                            // If we woke after the target it was the timer, so measure how late it was
+                            const auto error = NUClear::clock::now() - target;
+                            if (error.count() >= 0) {
+                                ++timer_wakeups;
+                                timer_jitter_max = error > timer_jitter_max ? error : timer_jitter_max;
+                                timer_jitter     = timer_wakeups == 1 ? error : ((timer_jitter * 99 + error) / 100);
+                            }
                         }
                         else if (time_until_task > cv_accuracy) {  // A long time in the future
                             // Wait on the cv
@@ -192,7 +260,7 @@ namespace extension {
                             }
                         }
                         else {
-                            while (NUClear::clock::now() < tasks.front().time) {
+                            while (NUClear::clock::now() < target) {
                                 // Spinlock until we get to the time
                             }
                         }
@@ -202,5 +270,30 @@ namespace extension {
         });
     }
 
+    bool ChronoController::run_period(const NUClear::clock::duration& period, NUClear::clock::time_point& time) {
+        auto it = periods.find(period);
+        if (it->second.empty()) {
+            periods.erase(it);
+            return false;
+        }
+
+        std::vector<std::unique_ptr<threading::ReactionTask>> batch;
+        batch.reserve(it->second.size());
+        for (const auto& reaction : it->second) {
+            batch.push_back(reaction->get_task());
+        }
+        powerplant.submit(std::move(batch));
+
+        time += period;
+        return true;
+    }
+
+    void ChronoController::poke() {
+        wait.notify_all();
+        if (timer.valid()) {
+            timer.notify();
+        }
+    }
+
 }  // namespace extension
 }  // namespace NUClear
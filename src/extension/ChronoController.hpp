@@ -23,22 +23,54 @@
 #ifndef NUCLEAR_EXTENSION_CHRONO_CONTROLLER_HPP
 #define NUCLEAR_EXTENSION_CHRONO_CONTROLLER_HPP
 
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
 #include "../Reactor.hpp"
+#include "../dsl/operation/ChronoTask.hpp"
+#include "../dsl/operation/PeriodicTask.hpp"
 #include "../message/TimeTravel.hpp"
+#include "../util/TimerFD.hpp"
+#include "../util/TimerWheel.hpp"
 
 namespace NUClear {
 namespace extension {
 
     class ChronoController : public Reactor {
     private:
-        using ChronoTask = NUClear::dsl::operation::ChronoTask;
+        using ChronoTask   = NUClear::dsl::operation::ChronoTask;
+        using PeriodicTask = NUClear::dsl::operation::PeriodicTask;
 
     public:
         explicit ChronoController(std::unique_ptr<NUClear::Environment> environment);
 
     private:
-        /// The list of tasks we need to process
-        std::vector<dsl::operation::ChronoTask> tasks;
+        /**
+         * Wakes the chrono thread so it looks at the tasks again.
+         *
+         * Must be called while holding the mutex.
+         */
+        void poke();
+
+        /**
+         * Submits all of the reactions that share a period as one batch.
+         *
+         * This is the callback of the single timer that serves each period.
+         * Once every reaction with the period has been unbound the timer removes itself.
+         *
+         * @param period the period whose reactions should be submitted
+         * @param time   the time the timer fired, which is moved on to the next tick
+         *
+         * @return `true` if the timer should run again at the updated time
+         */
+        bool run_period(const NUClear::clock::duration& period, NUClear::clock::time_point& time);
+
+        /// The tasks we need to process, indexed by id and ordered by the time they are due
+        util::TimerWheel<std::function<bool(NUClear::clock::time_point&)>> tasks;
+        /// The reactions run by each periodic timer, a period is in here for as long as its timer is in tasks
+        std::map<NUClear::clock::duration, std::vector<std::shared_ptr<threading::Reaction>>> periods;
         /// The mutex we use to lock the task list
         std::mutex mutex;
         /// The condition variable we use to wait on
@@ -46,6 +78,15 @@ namespace extension {
         /// If we are running or not
         std::atomic<bool> running{true};
 
+        /// The kernel timer we sleep on when the platform has one, otherwise we use the condition variable
+        util::TimerFD timer;
+        /// The average amount that wakeups from the kernel timer were late by
+        NUClear::clock::duration timer_jitter{0};
+        /// The most that a wakeup from the kernel timer was late by
+        NUClear::clock::duration timer_jitter_max{0};
+        /// The number of wakeups from the kernel timer that have been measured
+        uint64_t timer_wakeups{0};
+
         /// The temporal accuracy when waiting on a condition variable
         NUClear::clock::duration cv_accuracy{0};
         /// The temporal accuracy when waiting on nanosleep
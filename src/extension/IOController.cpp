@@ -22,6 +22,8 @@
 
 #ifdef _WIN32
     #include "IOController_Windows.ipp"
+#elif defined(__linux__)
+    #include "IOController_Epoll.ipp"
 #else
     #include "IOController_Posix.ipp"
 #endif  // _WIN32
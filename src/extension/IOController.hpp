@@ -25,8 +25,18 @@
 
 #include "../Reactor.hpp"
 #include "../dsl/word/IO.hpp"
+#include "../dsl/word/IORead.hpp"
 #include "../util/platform.hpp"
 
+#ifdef __linux__
+    #include <sys/epoll.h>
+
+    #include <map>
+    #include <mutex>
+
+    #include "../util/FileDescriptor.hpp"
+#endif
+
 #include <atomic>
 
 namespace NUClear {
@@ -45,6 +55,14 @@ namespace extension {
             WSAEVENT notifier{WSA_INVALID_EVENT};  ///< This is the event that is waited on by WSAWaitForMultipleEvents
             std::mutex mutex;                      ///< This mutex is used to ensure that wait has woken up
         };
+#elif defined(__linux__)
+        using event_t   = decltype(pollfd::events);
+        using watcher_t = epoll_event;
+        struct Watch;
+        using tasks_t = std::map<fd_t, std::shared_ptr<Watch>>;
+        struct notifier_t {
+            util::FileDescriptor fd;  ///< The eventfd that is watched by epoll and written to to wake it up
+        };
 #else
         using event_t   = decltype(pollfd::events);
         using watcher_t = pollfd;
@@ -58,6 +76,69 @@ namespace extension {
         };
 #endif
 
+#ifdef __linux__
+        /**
+         * A task that is waiting for an IO event.
+         */
+        struct Task {
+            /// The reaction is running with the task's events
+            static constexpr uint64_t PROCESSING = 1;
+            /// The reaction has finished, but the fd hasn't been armed for the task since so it has to be armed first
+            static constexpr uint64_t WAITING = 2;
+
+            Task(std::shared_ptr<Watch> watch, event_t listening_events, std::shared_ptr<threading::Reaction> reaction)
+                : watch(std::move(watch)), listening_events(listening_events), reaction(std::move(reaction)) {}
+
+            /// The file descriptor we are waiting on
+            std::shared_ptr<Watch> watch;
+            /// The events that the task is interested in
+            event_t listening_events;
+            /// The reaction that is waiting for this event
+            std::shared_ptr<threading::Reaction> reaction;
+            /// The events that are currently being processed, only touched by the thread that made the task processing
+            event_t processing_events{0};
+            /**
+             * PROCESSING, WAITING, or when idle the generation of the first arm that included it in the top 32 bits.
+             *
+             * Each change has one owner so it is never contended: the IO thread fires idle tasks, whoever is arming the
+             * fd makes waiting tasks idle, and the thread that finishes a task either fires it again or makes it wait.
+             */
+            std::atomic<uint64_t> state{WAITING};
+        };
+
+        /**
+         * A file descriptor that epoll is watching and the tasks that are waiting on it.
+         *
+         * The fd is registered one shot, so after epoll reports it nothing more is reported until it is re-armed.
+         * It is only re-armed for tasks that finish while the fd isn't ready, and re-arming makes epoll check if it is
+         * ready right then, so a task is only fired for readiness that has been seen since the task last finished.
+         */
+        struct Watch {
+            using TaskList = std::vector<std::shared_ptr<Task>>;
+
+            explicit Watch(const fd_t& fd) : fd(fd) {}
+            ~Watch() {
+                delete tasks.load(std::memory_order_relaxed);  // NOLINT(cppcoreguidelines-owning-memory)
+            }
+            Watch(const Watch&)            = delete;
+            Watch(Watch&&)                 = delete;
+            Watch& operator=(const Watch&) = delete;
+            Watch& operator=(Watch&&)      = delete;
+
+            /// The file descriptor
+            fd_t fd;
+            /// If epoll is watching this file descriptor, if not (e.g. regular files) it is treated as always ready
+            bool polled{true};
+            /// The tasks waiting on this fd, replaced while holding tasks_mutex and retired so a guard can read them
+            std::atomic<const TaskList*> tasks{new TaskList()};  // NOLINT(cppcoreguidelines-owning-memory)
+            /// The arms that have been asked for and not done, whoever takes this from 0 arms until it is back to 0
+            std::atomic<int> requests{0};
+            /// Counts the times the fd has been armed, a report is only for tasks that were idle by then
+            uint32_t generation{0};
+            /// Set once the last task has been removed, after which the fd is never armed again
+            std::atomic<bool> removed{false};
+        };
+#else
         /**
          * A task that is waiting for an IO event.
          */
@@ -93,8 +174,86 @@ namespace extension {
                 return lhs.fd == rhs.fd ? lhs.listening_events < rhs.listening_events : lhs.fd < rhs.fd;
             }
         };
+#endif
 
     private:
+#ifdef __linux__
+        /// The tasks by the id of their reaction, which reactions that have finished can look in without a lock
+        struct Index;
+
+        /**
+         * Arms epoll for the events the tasks on a file descriptor that aren't processing listen for.
+         *
+         * epoll checks the fd straight away, so it is reported if it is already ready.
+         * This can be called from any thread, if another thread is arming the fd it arms it again for this one.
+         *
+         * @param watch the file descriptor to arm
+         */
+        void arm(Watch& watch);
+
+        /**
+         * Adds a task for a reaction and starts watching its file descriptor.
+         *
+         * Must be called while holding tasks_mutex.
+         *
+         * @param fd       the file descriptor to watch
+         * @param events   the events the reaction listens for
+         * @param reaction the reaction to fire
+         *
+         * @return a reaction task to submit if the file descriptor is already ready, otherwise nullptr
+         */
+        std::unique_ptr<threading::ReactionTask> add_task(const fd_t& fd,
+                                                          event_t events,
+                                                          const std::shared_ptr<threading::Reaction>& reaction);
+
+        /**
+         * Makes the reaction task for some events, and records the events it is processing if one was made.
+         *
+         * Must be called by the thread that made the task processing.
+         *
+         * @param task   the task that the events happened on
+         * @param events the events that happened
+         *
+         * @return the reaction task to submit, or nullptr if the reaction didn't make one
+         */
+        std::unique_ptr<threading::ReactionTask> fire(Task& task, const event_t& events);
+
+        /**
+         * Called when a reaction has finished with its events to fire it again or re-arm its file descriptor.
+         *
+         * @param id the id of the reaction that has finished
+         */
+        void finished(const NUClear::id_t& id);
+
+        /**
+         * Replaces the list of tasks on a file descriptor, retiring the old one once nothing can be reading it.
+         *
+         * Must be called while holding tasks_mutex.
+         *
+         * @param watch the file descriptor whose tasks changed
+         * @param next  the new list of tasks
+         */
+        static void publish(Watch& watch, const Watch::TaskList* next);
+
+        /**
+         * Removes a task and stops watching its file descriptor if it was the last one.
+         *
+         * Must be called while holding tasks_mutex.
+         *
+         * @param task the task to remove
+         */
+        void remove_task(const std::shared_ptr<Task>& task);
+
+        /**
+         * The io_uring backed reads that IORead reactions are given their data from.
+         *
+         * It is shared with the buffers that have been handed out so it lives until the last of them is released.
+         */
+        struct Reads;
+
+        /// Lets IO reactions tell this controller directly when they have finished
+        struct Finisher;
+#else
         /**
          * Rebuilds the list of file descriptors to poll.
          *
@@ -102,7 +261,17 @@ namespace extension {
          * It will rebuild the list of file descriptors used by poll.
          */
         void rebuild_list();
+#endif
 
+#ifdef __linux__
+        /**
+         * Collects the events that have happened and sets them up to fire.
+         *
+         * @param event the event that epoll reported
+         * @param fired the list to add the reaction tasks that should be submitted to
+         */
+        void process_event(watcher_t& event, std::vector<std::unique_ptr<threading::ReactionTask>>& fired);
+#else
         /**
          * Fires the event for the task if it is ready.
          *
@@ -114,6 +283,7 @@ namespace extension {
          * Collects the events that have happened and sets them up to fire.
          */
         void process_event(watcher_t& event);
+#endif
 
         /**
          * Bumps the notification pipe to wake up the poll command.
@@ -126,6 +296,14 @@ namespace extension {
 
     public:
         explicit IOController(std::unique_ptr<NUClear::Environment> environment);
+#ifdef __linux__
+        ~IOController() override;
+
+        IOController(const IOController&)            = delete;
+        IOController(IOController&&)                 = delete;
+        IOController& operator=(const IOController&) = delete;
+        IOController& operator=(IOController&&)      = delete;
+#endif
 
     private:
         /// The event that is used to wake up the WaitForMultipleEvents call
@@ -135,10 +313,25 @@ namespace extension {
 
         /// The mutex that protects the tasks list
         std::mutex tasks_mutex;
+#ifdef __linux__
+        /// The epoll instance that watches every file descriptor
+        util::FileDescriptor epoll;
+        /// The buffer that epoll_wait fills with the events that happened
+        std::vector<watcher_t> watches;
+        /// The tasks by reaction id, changed while holding tasks_mutex
+        std::unique_ptr<Index> index;
+        /// Registered as the handler IO reactions tell when they have finished
+        std::unique_ptr<Finisher> finisher;
+        /// The io_uring reads, created when the first IORead reaction is bound
+        std::shared_ptr<Reads> reads;
+        /// If creating the io_uring reads failed, in which case IORead reactions fall back to readiness
+        bool reads_unsupported{false};
+#else
         /// Whether or not the list of file descriptors is dirty compared to tasks
         std::atomic<bool> dirty{true};
         /// The list of events that are being watched
         std::vector<watcher_t> watches;
+#endif
         /// The list of tasks that are waiting for IO events
         tasks_t tasks;
     };
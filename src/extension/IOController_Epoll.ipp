@@ -0,0 +1,1024 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <sys/eventfd.h>
+
+#include <deque>
+#include <functional>
+#include <thread>
+
+#include "../util/Epoch.hpp"
+#include "../util/IOUring.hpp"
+#include "IOController.hpp"
+
+namespace NUClear {
+namespace extension {
+
+    namespace {
+
+        /// The most events we collect from a single call to epoll_wait
+        constexpr std::size_t MAX_EVENTS = 1024;
+
+        /// The number of requests that can be queued on the io_uring at once
+        constexpr unsigned RING_ENTRIES = 256;
+
+        /// The number of buffers that the kernel can read into for IORead reactions
+        constexpr uint16_t BUFFER_COUNT = 64;
+
+
+        /// The number of slots the reaction index starts with, it always has a power of two
+        constexpr std::size_t MIN_INDEX_CAPACITY = 16;
+
+        /**
+         * Makes the data epoll gives back with an event for a file descriptor.
+         *
+         * @param fd         the file descriptor
+         * @param generation the number of times the file descriptor has been armed
+         *
+         * @return the fd in the low 32 bits and the generation in the high 32 bits
+         */
+        uint64_t event_data(const fd_t& fd, const uint32_t& generation) {
+            return (uint64_t(generation) << 32) | uint32_t(fd);
+        }
+
+        /// Gets the file descriptor an event is for
+        fd_t event_fd(const epoll_event& event) {
+            return fd_t(uint32_t(event.data.u64));
+        }
+
+        /// Gets the number of times the file descriptor had been armed when it was reported
+        uint32_t event_generation(const epoll_event& event) {
+            return uint32_t(event.data.u64 >> 32);
+        }
+
+        /**
+         * Works out the IO events from what epoll or poll reported for a file descriptor, which use the same bits.
+         *
+         * A socket that has been closed keeps reporting reads with 0 bytes, rather than a close.
+         * So once it has hung up and there is nothing left to read we treat it as closed.
+         *
+         * @param fd       the file descriptor that was reported
+         * @param reported the events that were reported
+         *
+         * @return the events to fire
+         */
+        IOController::event_t io_events(const fd_t& fd, const uint32_t& reported) {
+            auto revents = IOController::event_t(uint16_t(reported));
+            if ((reported & (EPOLLRDHUP | EPOLLHUP)) != 0) {
+                int bytes_available = 0;
+                const bool valid    = ::ioctl(fd, FIONREAD, &bytes_available) == 0;
+                revents             = IOController::event_t(revents & ~dsl::word::IO::CLOSE);
+                if (!valid || bytes_available == 0) {
+                    revents |= dsl::word::IO::CLOSE;
+                }
+            }
+            return revents;
+        }
+
+        /**
+         * Checks if a file descriptor is ready for a task right now, without waiting.
+         *
+         * @param fd        the file descriptor to check
+         * @param listening the events the task listens for
+         *
+         * @return the events to fire the task with, or 0 if it isn't ready
+         */
+        IOController::event_t ready_events(const fd_t& fd, const IOController::event_t& listening) {
+            pollfd pfd{fd, IOController::event_t(listening | POLLRDHUP), 0};
+            // A closed fd has already gone from epoll, so it is never reported again
+            if (::poll(&pfd, 1, 0) <= 0 || (pfd.revents & POLLNVAL) != 0) {
+                return 0;
+            }
+            const IOController::event_t revents = io_events(fd, uint16_t(pfd.revents));
+            return IOController::event_t((listening & revents) | (revents & dsl::word::IO::CLOSE));
+        }
+
+    }  // namespace
+
+    struct IOController::Reads : std::enable_shared_from_this<IOController::Reads> {
+
+        /**
+         * A read that has completed and is waiting to be given to its reaction.
+         */
+        struct Chunk {
+            /// The buffer that was read into, or -1 if nothing was read into one
+            int buffer;
+            /// The number of bytes that were read
+            std::size_t size;
+            /// If this is the last chunk for the fd
+            bool closed;
+        };
+
+        /**
+         * An IORead reaction and the state of the reads for it.
+         */
+        struct Registration {
+            Registration(const fd_t& fd, std::shared_ptr<threading::Reaction> reaction, bool socket, bool stream)
+                : fd(fd), reaction(std::move(reaction)), socket(socket), stream(stream), multishot(socket) {}
+
+            /// The file descriptor that is being read
+            fd_t fd;
+            /// The reaction that is given the data
+            std::shared_ptr<threading::Reaction> reaction;
+            /// If the fd is a socket, which are read with a receive
+            bool socket;
+            /// If reading nothing means the other end has closed, for datagrams it is just an empty datagram
+            bool stream;
+            /// If the socket can be read with a multishot receive, this is turned off if the kernel rejects it
+            bool multishot;
+            /// If there is a read queued in the ring that will produce more completions
+            bool armed{false};
+            /// If the reaction is currently holding one of the chunks
+            bool processing{false};
+            /// If the fd has closed and nothing more will be read from it
+            bool closed{false};
+            /// The chunks that have been read but not yet given to the reaction in the order they were read
+            std::deque<Chunk> pending;
+        };
+
+        explicit Reads(PowerPlant& powerplant)
+            : powerplant(powerplant), ring(RING_ENTRIES, BUFFER_COUNT, uint32_t(IORead::BUFFER_SIZE)) {}
+
+        /**
+         * Starts reading a file descriptor for a reaction.
+         *
+         * @param config the fd and reaction to read for
+         */
+        void add(const dsl::word::IOReadConfiguration& config) {
+            // Sockets are read with a receive, and for datagram sockets a read of nothing is not a close
+            int type            = 0;
+            socklen_t type_size = sizeof(type);
+            const bool socket   = ::getsockopt(config.fd, SOL_SOCKET, SO_TYPE, &type, &type_size) == 0;
+
+            const std::lock_guard<std::mutex> lock(mutex);
+            auto it = registrations
+                          .emplace(config.reaction->id,
+                                   Registration(config.fd, config.reaction, socket, !socket || type == SOCK_STREAM))
+                          .first;
+            arm(it->first, it->second);
+            ring.submit();
+        }
+
+        /**
+         * Stops reading for a reaction and gives back the buffers it had not been given yet.
+         *
+         * @param id the id of the reaction
+         */
+        void remove(const NUClear::id_t& id) {
+            const std::lock_guard<std::mutex> lock(mutex);
+            auto it = registrations.find(id);
+            if (it == registrations.end()) {
+                return;
+            }
+
+            for (const auto& chunk : it->second.pending) {
+                if (chunk.buffer >= 0) {
+                    give_back(uint16_t(chunk.buffer));
+                }
+            }
+            if (it->second.armed) {
+                ring.cancel(id);
+                ring.submit();
+            }
+            registrations.erase(it);
+        }
+
+        /**
+         * Collects the completed reads from the ring and gives them to their reactions.
+         *
+         * Reads that have finished are queued again straight away so the kernel can keep reading while the reactions
+         * are running.
+         */
+        void reap() {
+            std::vector<NUClear::id_t> ready;
+
+            /* mutex scope */ {
+                const std::lock_guard<std::mutex> lock(mutex);
+
+                completions.clear();
+                ring.reap(completions);
+                for (const auto& completion : completions) {
+                    const bool buffered   = util::IOUring::has_buffer(completion.flags);
+                    const uint16_t buffer = util::IOUring::buffer_id(completion.flags);
+                    if (buffered) {
+                        ++held;
+                    }
+
+                    // Completions for cancels, or for reactions that have already gone
+                    auto it = registrations.find(completion.user_data);
+                    if (it == registrations.end() || it->second.closed) {
+                        if (buffered) {
+                            give_back(buffer);
+                        }
+                        continue;
+                    }
+                    Registration& r = it->second;
+
+                    if (!util::IOUring::more(completion.flags)) {
+                        r.armed = false;
+                    }
+
+                    // Data, or an empty datagram
+                    if (buffered && (completion.result > 0 || !r.stream)) {
+                        r.pending.push_back(Chunk{buffer, std::size_t(std::max(completion.result, 0)), false});
+                    }
+                    else if (buffered) {
+                        give_back(buffer);
+                    }
+                    // The kernel doesn't take a buffer for an empty datagram
+                    else if (completion.result == 0 && !r.stream) {
+                        r.pending.push_back(Chunk{-1, 0, false});
+                    }
+
+                    if (completion.result == 0 && r.stream) {
+                        r.closed = true;
+                    }
+                    else if (completion.result < 0) {
+                        switch (-completion.result) {
+                            // Every buffer is in use, the read is queued again when one of them is given back
+                            case ENOBUFS: starved = true; break;
+                            // Kernels before 6.0 can't do multishot receives
+                            case EINVAL:
+                                if (r.multishot) {
+                                    r.multishot = false;
+                                }
+                                else {
+                                    r.closed = true;
+                                }
+                                break;
+                            case EAGAIN:
+                            case EINTR:
+                            case ECANCELED: break;
+                            default: r.closed = true; break;
+                        }
+                    }
+
+                    if (r.closed) {
+                        r.pending.push_back(Chunk{-1, 0, true});
+                    }
+                    else if (!r.armed && (completion.result != -ENOBUFS || held == 0)) {
+                        arm(it->first, r);
+                    }
+                    ready.push_back(it->first);
+                }
+                ring.submit();
+            }
+
+            std::sort(ready.begin(), ready.end());
+            ready.erase(std::unique(ready.begin(), ready.end()), ready.end());
+            for (const auto& id : ready) {
+                dispatch(id);
+            }
+        }
+
+        /**
+         * Gives the next chunk for a reaction to it if the reaction isn't still processing the last one.
+         *
+         * This must be called without the mutex held, as the task may be run inline and release its buffer.
+         *
+         * @param id the id of the reaction
+         */
+        void dispatch(const NUClear::id_t& id) {
+            IORead::Data data;
+            std::shared_ptr<threading::Reaction> reaction;
+
+            /* mutex scope */ {
+                const std::lock_guard<std::mutex> lock(mutex);
+                auto it = registrations.find(id);
+                if (it == registrations.end() || it->second.processing || it->second.pending.empty()) {
+                    return;
+                }
+                Registration& r   = it->second;
+                const Chunk chunk = r.pending.front();
+                r.pending.pop_front();
+
+                data.fd  = r.fd;
+                reaction = r.reaction;
+                if (chunk.closed) {
+                    data.closed = true;
+                    registrations.erase(it);
+                }
+                else {
+                    r.processing = true;
+                    data.data    = chunk.buffer < 0 ? nullptr : ring.buffer(uint16_t(chunk.buffer));
+                    data.size    = chunk.size;
+                    data.buffer  = std::shared_ptr<const void>(
+                        data.data,
+                        [self = shared_from_this(), id, buffer = chunk.buffer](const void* /*ptr*/) {
+                            self->release(id, buffer);
+                        });
+                }
+            }
+
+            IORead::ThreadDataStore::value             = &data;
+            std::unique_ptr<threading::ReactionTask> t = reaction->get_task();
+            IORead::ThreadDataStore::value             = nullptr;
+
+            // If no task was made this gives the buffer straight back and moves on to the next chunk
+            data = IORead::Data{};
+
+            powerplant.submit(std::move(t));
+        }
+
+        /**
+         * Called when a reaction lets go of a buffer to give it back to the kernel and move on to the next chunk.
+         *
+         * @param id     the id of the reaction
+         * @param buffer the buffer it was holding, or -1 if it wasn't holding one
+         */
+        void release(const NUClear::id_t& id, const int& buffer) {
+            /* mutex scope */ {
+                const std::lock_guard<std::mutex> lock(mutex);
+                if (buffer >= 0) {
+                    give_back(uint16_t(buffer));
+                }
+
+                auto it = registrations.find(id);
+                if (it != registrations.end()) {
+                    it->second.processing = false;
+                }
+
+                // Reads that ran out of buffers can go again now there is one
+                if (starved) {
+                    starved = false;
+                    for (auto& r : registrations) {
+                        if (!r.second.armed && !r.second.closed) {
+                            arm(r.first, r.second);
+                        }
+                    }
+                    ring.submit();
+                }
+
+                if (it == registrations.end()) {
+                    return;
+                }
+            }
+
+            dispatch(id);
+        }
+
+        /**
+         * Queues the next read for a reaction, the caller must hold the mutex and submit the ring.
+         *
+         * @param id the id of the reaction
+         * @param r  the registration of the reaction
+         */
+        void arm(const NUClear::id_t& id, Registration& r) {
+            r.armed = ring.read(r.fd, id, r.socket, r.multishot);
+        }
+
+        /**
+         * Hands a buffer back to the kernel, the caller must hold the mutex.
+         *
+         * @param buffer the buffer to give back
+         */
+        void give_back(const uint16_t& buffer) {
+            ring.recycle(buffer);
+            --held;
+        }
+
+        /// The powerplant to submit the tasks to
+        PowerPlant& powerplant;
+        /// The mutex that protects the ring and the registrations
+        std::mutex mutex;
+        /// The ring that the reads are made through
+        util::IOUring ring;
+        /// The reactions that are being read for, by reaction id which is also the user_data of their reads
+        std::map<NUClear::id_t, Registration> registrations;
+        /// The list that completions are reaped into, kept to avoid allocating each time
+        std::vector<util::IOUring::Completion> completions;
+        /// The number of buffers that have been filled and not given back yet
+        std::size_t held{0};
+        /// If a read has stopped because every buffer was in use
+        bool starved{false};
+    };
+
+
+    /**
+     * An open addressed table of tasks by the id of their reaction.
+     *
+     * It is only changed while holding tasks_mutex, while readers only hold an Epoch::Guard.
+     * Adding or removing a task only touches its own slot, and the table is only copied when it needs to grow, so
+     * binding a reaction costs the same however many are already bound.
+     * Removed entries and outgrown tables are retired so readers can finish looking at them.
+     */
+    struct IOController::Index {
+        /// A task and the id of its reaction, an entry never changes once it is in the table
+        struct Entry {
+            NUClear::id_t id;
+            std::shared_ptr<Task> task;
+        };
+
+        /// The slots of the table, at most half of which are used so that a search always reaches an empty slot
+        struct Table {
+            explicit Table(const std::size_t& capacity) : slots(capacity) {}
+
+            /// Each slot is empty, holds an entry, or holds the removed marker
+            std::vector<std::atomic<const Entry*>> slots;
+            /// The number of slots that are not empty, including the removed ones
+            std::size_t used{0};
+        };
+
+        Index() : table(new Table(MIN_INDEX_CAPACITY)) {}  // NOLINT(cppcoreguidelines-owning-memory)
+        ~Index() {
+            const Table* t = table.load(std::memory_order_acquire);
+            for (const auto& slot : t->slots) {
+                const Entry* entry = slot.load(std::memory_order_relaxed);
+                if (entry != nullptr && entry != removed()) {
+                    delete entry;  // NOLINT(cppcoreguidelines-owning-memory)
+                }
+            }
+            delete t;  // NOLINT(cppcoreguidelines-owning-memory)
+        }
+        Index(const Index&)            = delete;
+        Index(Index&&)                 = delete;
+        Index& operator=(const Index&) = delete;
+        Index& operator=(Index&&)      = delete;
+
+        /**
+         * Finds the task for a reaction, this can be called from any thread.
+         *
+         * @param id the id of the reaction
+         *
+         * @return the task for the reaction, or nullptr if it doesn't have one
+         */
+        std::shared_ptr<Task> find(const NUClear::id_t& id) const {
+            const util::Epoch::Guard guard;
+            const Table* t         = table.load(std::memory_order_seq_cst);
+            const std::size_t mask = t->slots.size() - 1;
+            for (std::size_t i = home(id, mask);; i = (i + 1) & mask) {
+                const Entry* entry = t->slots[i].load(std::memory_order_seq_cst);
+                if (entry == nullptr) {
+                    return nullptr;
+                }
+                if (entry != removed() && entry->id == id) {
+                    return entry->task;
+                }
+            }
+        }
+
+        /**
+         * Adds the task for a reaction, the caller must hold tasks_mutex.
+         *
+         * @param id   the id of the reaction
+         * @param task the task for the reaction
+         */
+        void insert(const NUClear::id_t& id, std::shared_ptr<Task> task) {
+            Table* t = table.load(std::memory_order_relaxed);
+            if ((t->used + 1) * 2 > t->slots.size()) {
+                t = rebuild();
+            }
+            place(*t, new Entry{id, std::move(task)});  // NOLINT(cppcoreguidelines-owning-memory)
+            ++live;
+        }
+
+        /**
+         * Removes the task for a reaction, the caller must hold tasks_mutex.
+         *
+         * @param id the id of the reaction
+         */
+        void erase(const NUClear::id_t& id) {
+            Table* t               = table.load(std::memory_order_relaxed);
+            const std::size_t mask = t->slots.size() - 1;
+            for (std::size_t i = home(id, mask);; i = (i + 1) & mask) {
+                const Entry* entry = t->slots[i].load(std::memory_order_relaxed);
+                if (entry == nullptr) {
+                    return;
+                }
+                if (entry != removed() && entry->id == id) {
+                    t->slots[i].store(removed(), std::memory_order_seq_cst);
+                    --live;
+                    util::Epoch::retire(entry, [](const void* ptr) {
+                        delete static_cast<const Entry*>(ptr);  // NOLINT(cppcoreguidelines-owning-memory)
+                    });
+                    // The entry holds on to the reaction, so release it as soon as possible
+                    util::Epoch::reclaim();
+                    return;
+                }
+            }
+        }
+
+    private:
+        /// Marks a slot whose entry was removed, searches continue past it but new entries can reuse it
+        static const Entry* removed() {
+            static const Entry marker{0, nullptr};
+            return &marker;
+        }
+
+        /// The slot a search for an id starts at
+        static std::size_t home(const NUClear::id_t& id, const std::size_t& mask) {
+            return std::hash<NUClear::id_t>()(id) & mask;
+        }
+
+        /**
+         * Puts an entry in the first free slot for its id, the table must have room for it.
+         *
+         * @param t     the table to put the entry in
+         * @param entry the entry to put in it
+         */
+        static void place(Table& t, const Entry* entry) {
+            const std::size_t mask = t.slots.size() - 1;
+            for (std::size_t i = home(entry->id, mask);; i = (i + 1) & mask) {
+                const Entry* current = t.slots[i].load(std::memory_order_relaxed);
+                if (current == nullptr || current == removed()) {
+                    t.used += current == nullptr ? 1 : 0;
+                    t.slots[i].store(entry, std::memory_order_seq_cst);
+                    return;
+                }
+            }
+        }
+
+        /**
+         * Moves the entries into a new table with room for as many again, dropping the removed markers.
+         *
+         * @return the new table
+         */
+        Table* rebuild() {
+            std::size_t capacity = MIN_INDEX_CAPACITY;
+            while (capacity < (live + 1) * 4) {
+                capacity *= 2;
+            }
+
+            Table* current = table.load(std::memory_order_relaxed);
+            auto* next     = new Table(capacity);  // NOLINT(cppcoreguidelines-owning-memory)
+            for (const auto& slot : current->slots) {
+                const Entry* entry = slot.load(std::memory_order_relaxed);
+                if (entry != nullptr && entry != removed()) {
+                    place(*next, entry);
+                }
+            }
+
+            // The entries now belong to the new table, so only the old slots are deleted
+            table.store(next, std::memory_order_seq_cst);
+            util::Epoch::retire(current, [](const void* ptr) {
+                delete static_cast<const Table*>(ptr);  // NOLINT(cppcoreguidelines-owning-memory)
+            });
+            return next;
+        }
+
+        /// The current table
+        std::atomic<Table*> table;
+        /// The number of entries in the table
+        std::size_t live{0};
+    };
+
+    std::unique_ptr<threading::ReactionTask> IOController::add_task(
+        const fd_t& fd,
+        event_t events,
+        const std::shared_ptr<threading::Reaction>& reaction) {
+
+        // A new fd, start watching it
+        auto& watch = tasks[fd];
+        if (watch == nullptr) {
+            watch = std::make_shared<Watch>(fd);
+
+            // It is added disarmed, and armed once its task is in place
+            epoll_event event{};
+            event.events   = EPOLLONESHOT;
+            event.data.u64 = event_data(fd, watch->generation);
+            if (::epoll_ctl(epoll.get(), EPOLL_CTL_ADD, fd, &event) < 0) {
+                // epoll can't watch things like regular files, poll would always report these as ready so we do too
+                if (errno == EPERM) {
+                    watch->polled = false;
+                }
+                // A closed fd that was reused before it was unbound is still in epoll
+                else if (errno != EEXIST) {
+                    tasks.erase(fd);
+                    throw std::system_error(network_errno,
+                                            std::system_category(),
+                                            "There was an error while adding a file descriptor to epoll");
+                }
+            }
+        }
+
+        auto task = std::make_shared<Task>(watch, events, reaction);
+        index->insert(reaction->id, task);
+
+        const Watch::TaskList* current = watch->tasks.load(std::memory_order_relaxed);
+        auto* next                     = new Watch::TaskList(*current);  // NOLINT(cppcoreguidelines-owning-memory)
+        next->push_back(task);
+        publish(*watch, next);
+
+        // Files that epoll can't watch are always ready
+        if (!watch->polled) {
+            task->state.store(Task::PROCESSING, std::memory_order_release);
+            return fire(*task, event_t(events & (IO::READ | IO::WRITE)));
+        }
+        arm(*watch);
+        return nullptr;
+    }
+
+    void IOController::publish(Watch& watch, const Watch::TaskList* next) {
+        const Watch::TaskList* previous = watch.tasks.exchange(next, std::memory_order_seq_cst);
+        util::Epoch::retire(previous, [](const void* ptr) {
+            delete static_cast<const Watch::TaskList*>(ptr);  // NOLINT(cppcoreguidelines-owning-memory)
+        });
+        // The list holds on to the reactions, so release it as soon as possible
+        util::Epoch::reclaim();
+    }
+
+    void IOController::remove_task(const std::shared_ptr<Task>& task) {
+        Watch& watch = *task->watch;
+
+        // It may have already been removed by an unbind or a close
+        const Watch::TaskList* current = watch.tasks.load(std::memory_order_relaxed);
+        auto it                        = std::find(current->begin(), current->end(), task);
+        if (it == current->end()) {
+            return;
+        }
+        auto* next = new Watch::TaskList(current->begin(), it);  // NOLINT(cppcoreguidelines-owning-memory)
+        next->insert(next->end(), std::next(it), current->end());
+        publish(watch, next);
+        index->erase(task->reaction->id);
+
+        // No tasks left, stop watching this fd
+        if (next->empty()) {
+            // Once a thread that is arming it has finished nothing will arm it again
+            watch.removed.store(true, std::memory_order_seq_cst);
+            while (watch.requests.load(std::memory_order_seq_cst) != 0) {
+                std::this_thread::yield();
+            }
+            if (watch.polled) {
+                // If the fd was already closed epoll has removed it for us
+                ::epoll_ctl(epoll.get(), EPOLL_CTL_DEL, watch.fd, nullptr);
+            }
+            auto slot = tasks.find(watch.fd);
+            if (slot != tasks.end() && slot->second == task->watch) {
+                tasks.erase(slot);
+            }
+        }
+        // Stop watching for what only this task listened for
+        else {
+            arm(watch);
+        }
+    }
+
+    void IOController::arm(Watch& watch) {
+        // Someone else is arming it, they will arm it again once they are done so it includes what we changed
+        if (watch.requests.fetch_add(1, std::memory_order_seq_cst) != 0) {
+            return;
+        }
+
+        int requests = 1;
+        do {
+            // A watch whose last task has gone is no longer in epoll
+            if (!watch.removed.load(std::memory_order_seq_cst)) {
+                const util::Epoch::Guard guard;
+                const uint32_t generation = watch.generation + 1;
+
+                // Watch for what the tasks that aren't processing listen for
+                // Tasks that were waiting are only fired for reports from this arm on
+                uint32_t events = 0;
+                for (const auto& task : *watch.tasks.load(std::memory_order_seq_cst)) {
+                    uint64_t state = task->state.load(std::memory_order_acquire);
+                    if (state == Task::WAITING) {
+                        state = uint64_t(generation) << 32;
+                        task->state.store(state, std::memory_order_release);
+                    }
+                    if (state != Task::PROCESSING) {
+                        events |= uint16_t(task->listening_events);
+                    }
+                }
+
+                // If every task is processing epoll has already reported the fd, so it is already disarmed
+                if (events != 0) {
+                    watch.generation = generation;
+
+                    // Hang ups are always watched so reads can see the end of a stream
+                    epoll_event event{};
+                    event.events   = events | EPOLLRDHUP | EPOLLONESHOT;
+                    event.data.u64 = event_data(watch.fd, generation);
+                    // If the fd was closed and the number reused since we added it, the new file needs adding
+                    if (::epoll_ctl(epoll.get(), EPOLL_CTL_MOD, watch.fd, &event) < 0 && errno == ENOENT) {
+                        ::epoll_ctl(epoll.get(), EPOLL_CTL_ADD, watch.fd, &event);
+                    }
+                }
+            }
+            requests = watch.requests.fetch_sub(requests, std::memory_order_seq_cst) - requests;
+        } while (requests != 0);
+    }
+
+    std::unique_ptr<threading::ReactionTask> IOController::fire(Task& task, const event_t& events) {
+        // Make our event to pass through and store it in the local cache
+        IO::Event e{};
+        e.fd     = task.watch->fd;
+        e.events = events;
+
+        // Get the task (which should run the get)
+        IO::ThreadEventStore::value                = &e;
+        std::unique_ptr<threading::ReactionTask> r = task.reaction->get_task();
+        IO::ThreadEventStore::value                = nullptr;
+
+        // The get can add a close to the events when it finds the fd has ended, which removes the task once it is done
+        if (r != nullptr) {
+            task.processing_events = e.events;
+        }
+        return r;
+    }
+
+    void IOController::finished(const NUClear::id_t& id) {
+
+        // Find the task for the reaction that finished processing
+        const std::shared_ptr<Task> task = index->find(id);
+        if (task == nullptr) {
+            return;
+        }
+        Watch& watch = *task->watch;
+
+        const event_t processing = task->processing_events;
+        task->processing_events  = 0;
+
+        // If the events we were processing included close remove it
+        if ((processing & IO::CLOSE) != 0) {
+            const std::lock_guard<std::mutex> lock(tasks_mutex);
+            remove_task(task);
+            return;
+        }
+
+        // Files that epoll can't watch are always ready, and anything else that is still ready goes again straight
+        // away without having to go through epoll and the IO thread
+        const event_t events = watch.polled ? ready_events(watch.fd, task->listening_events)
+                                            : event_t(task->listening_events & (IO::READ | IO::WRITE));
+        std::unique_ptr<threading::ReactionTask> next = events != 0 ? fire(*task, events) : nullptr;
+
+        // Otherwise wait for epoll to report it
+        // A reaction that didn't make a task waits too, so the next arm reports the fd again if it is still ready
+        if (next == nullptr) {
+            task->state.store(Task::WAITING, std::memory_order_release);
+            if (watch.polled) {
+                arm(watch);
+            }
+        }
+        powerplant.submit(std::move(next));
+    }
+
+    void IOController::process_event(epoll_event& event, std::vector<std::unique_ptr<threading::ReactionTask>>& fired) {
+        const fd_t fd = event_fd(event);
+
+        // It's our notification handle
+        if (fd == notifier.fd.get()) {
+            // Read our value to clear it's read status
+            uint64_t val = 0;
+            if (::read(fd, &val, sizeof(val)) < 0 && errno != EAGAIN) {
+                throw std::system_error(network_errno,
+                                        std::system_category(),
+                                        "There was an error reading our notification eventfd?");
+            }
+            return;
+        }
+
+        // There are no tasks for this, make sure epoll stops watching it
+        auto it = tasks.find(fd);
+        if (it == tasks.end()) {
+            ::epoll_ctl(epoll.get(), EPOLL_CTL_DEL, fd, nullptr);
+            return;
+        }
+        Watch& watch              = *it->second;
+        const uint32_t generation = event_generation(event);
+        const event_t revents     = io_events(fd, event.events);
+
+        // The list is only replaced while holding tasks_mutex, which we are holding
+        // Tasks that are processing, or that were waiting until after this was armed, are covered by a later arm
+        bool waiting = false;
+        for (const auto& task : *watch.tasks.load(std::memory_order_relaxed)) {
+            const uint64_t state = task->state.load(std::memory_order_acquire);
+            const bool idle      = state != Task::PROCESSING && state != Task::WAITING;
+            // Closes are always delivered so the task is removed, even if it was only reading
+            const event_t events = event_t((task->listening_events & revents) | (revents & IO::CLOSE));
+            if (idle && events != 0 && int32_t(generation - uint32_t(state >> 32)) >= 0) {
+                task->state.store(Task::PROCESSING, std::memory_order_release);
+                auto r = fire(*task, events);
+                if (r != nullptr) {
+                    fired.push_back(std::move(r));
+                }
+                else {
+                    task->state.store(Task::WAITING, std::memory_order_release);
+                    waiting = true;
+                }
+            }
+            else {
+                waiting |= state != Task::PROCESSING;
+            }
+        }
+
+        // epoll won't report it again until it is re-armed, so keep watching for the tasks that weren't fired
+        if (waiting) {
+            arm(watch);
+        }
+    }
+
+    void IOController::bump() {
+        const uint64_t val = 1;
+        if (::write(notifier.fd.get(), &val, sizeof(val)) < 0 && errno != EAGAIN) {
+            throw std::system_error(network_errno,
+                                    std::system_category(),
+                                    "There was an error while writing to the notification eventfd");
+        }
+    }
+
+    struct IOController::Finisher : dsl::word::IOFinishedHandler {
+        explicit Finisher(IOController& controller) : controller(controller) {}
+
+        void finished(const NUClear::id_t& id) override {
+            controller.finished(id);
+        }
+
+        /// The controller to tell
+        IOController& controller;
+    };
+
+    IOController::IOController(std::unique_ptr<NUClear::Environment> environment)
+        : Reactor(std::move(environment))
+        , epoll(::epoll_create1(EPOLL_CLOEXEC))
+        , watches(MAX_EVENTS)
+        , index(std::make_unique<Index>())
+        , finisher(std::make_unique<Finisher>(*this)) {
+
+        if (!epoll.valid()) {
+            throw std::system_error(network_errno, std::system_category(), "We were unable to make the epoll for IO");
+        }
+
+        notifier.fd = util::FileDescriptor(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC));
+        if (!notifier.fd.valid()) {
+            throw std::system_error(network_errno,
+                                    std::system_category(),
+                                    "We were unable to make the notification eventfd for IO");
+        }
+
+        epoll_event event{};
+        event.events   = EPOLLIN;
+        event.data.u64 = event_data(notifier.fd.get(), 0);
+        if (::epoll_ctl(epoll.get(), EPOLL_CTL_ADD, notifier.fd.get(), &event) < 0) {
+            throw std::system_error(network_errno,
+                                    std::system_category(),
+                                    "We were unable to add the notification eventfd to epoll");
+        }
+
+        // IO reactions can now tell us they are finished without emitting IOFinished
+        // If another IO controller in this powerplant has already taken the handler our reactions emit IOFinished
+        dsl::word::IOFinishedHandler* none = nullptr;
+        dsl::word::IOFinishedHandler::current(powerplant)
+            .compare_exchange_strong(none, finisher.get(), std::memory_order_acq_rel);
+
+        // epoll_ctl can be called while another thread is in epoll_wait, so changing what we watch never needs to
+        // wake the IO thread up
+        on<Trigger<dsl::word::IOConfiguration>>().then(
+            "Configure IO Reaction",
+            [this](const dsl::word::IOConfiguration& config) {
+                std::unique_ptr<threading::ReactionTask> fired;
+                /* mutex scope */ {
+                    // Lock our mutex to avoid concurrent modification
+                    const std::lock_guard<std::mutex> lock(tasks_mutex);
+                    fired = add_task(config.fd, event_t(config.events), config.reaction);
+                }
+                powerplant.submit(std::move(fired));
+            });
+
+        on<Trigger<dsl::word::IOReadConfiguration>>().then(
+            "Configure IO Read Reaction",
+            [this](const dsl::word::IOReadConfiguration& config) {
+                std::unique_ptr<threading::ReactionTask> fired;
+                /* mutex scope */ {
+                    // Lock our mutex to avoid concurrent modification
+                    const std::lock_guard<std::mutex> lock(tasks_mutex);
+
+                    // The ring is only made once something wants it, if the kernel can't do it we don't try again
+                    if (reads == nullptr && !reads_unsupported) {
+                        auto created = std::make_shared<Reads>(powerplant);
+
+                        epoll_event event{};
+                        event.events   = EPOLLIN;
+                        event.data.u64 = event_data(created->ring.fd(), 0);
+                        if (created->ring.valid()
+                            && ::epoll_ctl(epoll.get(), EPOLL_CTL_ADD, created->ring.fd(), &event) == 0) {
+                            reads = created;
+                        }
+                        else {
+                            reads_unsupported = true;
+                        }
+                    }
+
+                    if (reads != nullptr) {
+                        reads->add(config);
+                    }
+                    // Without io_uring watch the fd for readiness, and IORead will do the read itself
+                    else {
+                        fired = add_task(config.fd, event_t(IO::READ | IO::CLOSE | IO::ERROR), config.reaction);
+                    }
+                }
+                powerplant.submit(std::move(fired));
+            });
+
+        // Reactions normally tell us directly, this is for anything that still emits the message
+        on<Trigger<dsl::word::IOFinished>>().then("IO Finished", [this](const dsl::word::IOFinished& event) {
+            finished(event.id);
+        });
+
+        on<Trigger<dsl::operation::Unbind<IO>>>().then(
+            "Unbind IO Reaction",
+            [this](const dsl::operation::Unbind<IO>& unbind) {
+                // Lock our mutex to avoid concurrent modification
+                const std::lock_guard<std::mutex> lock(tasks_mutex);
+
+                // Find our reaction
+                const std::shared_ptr<Task> task = index->find(unbind.id);
+                if (task != nullptr) {
+                    remove_task(task);
+                }
+            });
+
+        on<Trigger<dsl::operation::Unbind<IORead>>>().then(
+            "Unbind IO Read Reaction",
+            [this](const dsl::operation::Unbind<IORead>& unbind) {
+                std::shared_ptr<Reads> r;
+                /* mutex scope */ {
+                    const std::lock_guard<std::mutex> lock(tasks_mutex);
+                    r = reads;
+                }
+                if (r != nullptr) {
+                    r->remove(unbind.id);
+                }
+            });
+
+        on<Shutdown>().then("Shutdown IO Controller", [this] {
+            running.store(false, std::memory_order_release);
+            bump();
+        });
+
+        on<Always>().then("IO Controller", [this] {
+            // Stay in this reaction to improve the performance without going back/fourth between reactions
+            if (running.load(std::memory_order_acquire)) {
+
+                // Wait for an event to happen on one of our file descriptors
+                const int count = ::epoll_wait(epoll.get(), watches.data(), int(watches.size()), -1);
+                if (count < 0) {
+                    if (errno == EINTR) {
+                        return;
+                    }
+                    throw std::system_error(network_errno,
+                                            std::system_category(),
+                                            "There was an IO error while attempting to wait on the file descriptors");
+                }
+
+                // The tasks that were fired are submitted together after we let go of the lock
+                std::vector<std::unique_ptr<threading::ReactionTask>> fired;
+
+                // The io_uring has completed reads, these are given out after we let go of the lock
+                std::shared_ptr<Reads> completed;
+
+                /* mutex scope */ {
+                    // Get the lock so we don't concurrently modify the list
+                    const std::lock_guard<std::mutex> lock(tasks_mutex);
+                    for (int i = 0; i < count; ++i) {
+                        if (reads != nullptr && event_fd(watches[i]) == reads->ring.fd()) {
+                            completed = reads;
+                        }
+                        else {
+                            process_event(watches[i], fired);
+                        }
+                    }
+                }
+
+                powerplant.submit(std::move(fired));
+
+                if (completed != nullptr) {
+                    completed->reap();
+                }
+            }
+        });
+    }
+
+    IOController::~IOController() {
+        // Stop IO reactions from telling us they have finished, and wait for any that are in the middle of it
+        dsl::word::IOFinishedHandler* self = finisher.get();
+        dsl::word::IOFinishedHandler::current(powerplant)
+            .compare_exchange_strong(self, nullptr, std::memory_order_acq_rel);
+        finisher->close();
+
+        // A reaction may have loaded the handler without having looked at it yet, so it is deleted once none can have
+        util::Epoch::retire(finisher.release(), [](const void* ptr) {
+            delete static_cast<const Finisher*>(ptr);  // NOLINT(cppcoreguidelines-owning-memory)
+        });
+    }
+
+}  // namespace extension
+}  // namespace NUClear
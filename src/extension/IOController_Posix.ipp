@@ -132,7 +132,8 @@ namespace extension {
 
             if (r != nullptr) {
                 // Clear the waiting events, we are now processing them
-                task.processing_events = task.waiting_events;
+                // The get can add a close to them when it finds the fd has ended, so the task is removed when done
+                task.processing_events = e.events;
                 task.waiting_events    = 0;
 
                 // Mask out the currently processing events so poll doesn't notify for them
@@ -250,6 +251,16 @@ namespace extension {
                 bump();
             });
 
+        // There is no completion based IO here, so IORead watches for readiness and does the read itself
+        on<Trigger<dsl::word::IOReadConfiguration>>().then(
+            "Configure IO Read Reaction",
+            [this](const dsl::word::IOReadConfiguration& config) {
+                emit<Scope::INLINE>(std::make_unique<dsl::word::IOConfiguration>(
+                    config.fd,
+                    event_t(IO::READ | IO::CLOSE | IO::ERROR),
+                    config.reaction));
+            });
+
         on<Trigger<dsl::word::IOFinished>>().then("IO Finished", [this](const dsl::word::IOFinished& event) {
             // Get the lock so we don't concurrently modify the list
             const std::lock_guard<std::mutex> lock(tasks_mutex);
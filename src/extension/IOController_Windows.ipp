@@ -84,6 +84,8 @@ namespace extension {
             IO::ThreadEventStore::value                = nullptr;
 
             if (r != nullptr) {
+                // The get can add a close to the events when it finds the fd has ended, so the task is then removed
+                task.processing_events = e.events;
                 powerplant.submit(std::move(r));
             }
             else {
@@ -177,6 +179,16 @@ namespace extension {
                 bump();
             });
 
+        // There is no completion based IO here, so IORead watches for readiness and does the read itself
+        on<Trigger<dsl::word::IOReadConfiguration>>().then(
+            "Configure IO Read Reaction",
+            [this](const dsl::word::IOReadConfiguration& config) {
+                emit<Scope::INLINE>(std::make_unique<dsl::word::IOConfiguration>(
+                    config.fd,
+                    event_t(IO::READ | IO::CLOSE | IO::ERROR),
+                    config.reaction));
+            });
+
         on<Trigger<dsl::word::IOFinished>>().then("IO Finished", [this](const dsl::word::IOFinished& event) {
             // Get the lock so we don't concurrently modify the list
             const std::lock_guard<std::mutex> lock(tasks_mutex);
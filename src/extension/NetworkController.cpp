@@ -43,6 +43,7 @@ namespace NUClear {
 namespace extension {
 
     using NetworkListen        = dsl::word::NetworkListen;
+    using NetworkSource        = dsl::word::NetworkSource;
     using NetworkEmit          = dsl::word::emit::NetworkEmit;
     using NetworkConfiguration = message::NetworkConfiguration;
     using Unbind               = dsl::operation::Unbind<NetworkListen>;
@@ -56,12 +57,16 @@ namespace extension {
                                            const uint64_t& hash,
                                            const bool& reliable,
                                            std::vector<uint8_t>&& payload) {
-            // Construct our NetworkSource information
-            const dsl::word::NetworkSource src{remote.name, remote.target, reliable};
+            // Construct our NetworkSource information, shared by every reaction
+            const std::shared_ptr<const NetworkSource> src =
+                std::make_shared<NetworkSource>(NetworkSource{remote.name, remote.target, reliable});
 
             // Move the payload in as we are stealing it
             const std::vector<uint8_t> p(std::move(payload));
 
+            // The payload deserialised by each deserialiser that has been needed so far
+            std::vector<std::pair<NetworkListen::Deserialiser, std::shared_ptr<const void>>> decoded;
+
             /* Mutex Scope */ {
                 // Lock our reaction mutex
                 const std::lock_guard<std::mutex> lock(reaction_mutex);
@@ -71,16 +76,31 @@ namespace extension {
 
                 // Execute on our interested reactions
                 for (auto it = rs.first; it != rs.second; ++it) {
+                    const NetworkListen& listen = it->second;
+
+                    // A disabled reaction won't make a task, so don't deserialise anything for it
+                    if (!listen.reaction->is_enabled()) {
+                        continue;
+                    }
+
+                    // Deserialise the payload the first time a reaction needs this type
+                    auto d = std::find_if(decoded.begin(), decoded.end(), [&](const auto& v) {
+                        return v.first == listen.deserialise;
+                    });
+                    if (d == decoded.end()) {
+                        d = decoded.emplace(decoded.end(), listen.deserialise, listen.deserialise(p));
+                    }
+
                     // Store in our thread local cache
-                    dsl::store::ThreadStore<const std::vector<uint8_t>>::value     = &p;
-                    dsl::store::ThreadStore<const dsl::word::NetworkSource>::value = &src;
+                    dsl::store::ThreadStore<const std::shared_ptr<const void>>::value          = &d->second;
+                    dsl::store::ThreadStore<const std::shared_ptr<const NetworkSource>>::value = &src;
 
-                    powerplant.submit(it->second->get_task());
+                    powerplant.submit(listen.reaction->get_task());
                 }
 
                 // Clear our cache
-                dsl::store::ThreadStore<const std::vector<uint8_t>>::value     = nullptr;
-                dsl::store::ThreadStore<const dsl::word::NetworkSource>::value = nullptr;
+                dsl::store::ThreadStore<const std::shared_ptr<const void>>::value          = nullptr;
+                dsl::store::ThreadStore<const std::shared_ptr<const NetworkSource>>::value = nullptr;
             }
         });
 
@@ -113,7 +133,7 @@ namespace extension {
             const std::lock_guard<std::mutex> lock(reaction_mutex);
 
             // Insert our new reaction
-            reactions.insert(std::make_pair(l.hash, l.reaction));
+            reactions.insert(std::make_pair(l.hash, l));
         });
 
         // Stop listening for a network type
@@ -123,7 +143,7 @@ namespace extension {
 
             // Find and delete this reaction
             auto it = std::find_if(reactions.begin(), reactions.end(), [&](const auto& r) {
-                return r.second->id == unbind.id;
+                return r.second.reaction->id == unbind.id;
             });
             if (it != reactions.end()) {
                 reactions.erase(it);
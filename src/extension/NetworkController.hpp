@@ -52,8 +52,8 @@ namespace extension {
 
         /// Mutex to guard the list of reactions
         std::mutex reaction_mutex;
-        /// Map of type hashes to reactions that are interested in them
-        std::multimap<uint64_t, std::shared_ptr<threading::Reaction>> reactions;
+        /// Map of type hashes to reactions that are interested in them and how they deserialise the data
+        std::multimap<uint64_t, dsl::word::NetworkListen> reactions;
     };
 
 }  // namespace extension
@@ -25,6 +25,7 @@
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <cerrno>
 #include <chrono>
 #include <cstdint>
 #include <cstring>
@@ -39,48 +40,30 @@
 #include <vector>
 
 #include "../../util/network/if_number_from_address.hpp"
+#include "../../util/network/recv_datagrams.hpp"
 #include "../../util/network/resolve.hpp"
 #include "../../util/network/sock_t.hpp"
 #include "../../util/platform.hpp"
 #include "wire_protocol.hpp"
 
+#ifdef __linux__
+    #include <netinet/udp.h>
+#endif
+
 namespace NUClear {
 namespace extension {
     namespace network {
 
         namespace {  // Anonymous namespace for internal linkage
 
-            /**
-             * Read a single packet from the given udp file descriptor.
-             *
-             * @param fd The file descriptor to read from
-             *
-             * @return The data and who it was sent from
-             */
-            std::pair<util::network::sock_t, std::vector<uint8_t>> read_socket(fd_t fd) {
-
-                // Allocate a vector that can hold a datagram
-                std::vector<uint8_t> payload(1500);
-                iovec iov{};
-                iov.iov_base = reinterpret_cast<char*>(payload.data());
-                iov.iov_len  = static_cast<decltype(iov.iov_len)>(payload.size());
-
-                // Who we are receiving from
-                util::network::sock_t from{};
-
-                // Setup our message header to receive
-                msghdr mh{};
-                mh.msg_name    = &from.sock;
-                mh.msg_namelen = sizeof(from);
-                mh.msg_iov     = &iov;
-                mh.msg_iovlen  = 1;
-
-                // Now read the data for real
-                const ssize_t received = recvmsg(fd, &mh, 0);
-                payload.resize(received);
-
-                return {from, std::move(payload)};
-            }
+            /// The most fragments that are handed to the kernel in one call
+            constexpr std::size_t MAX_FRAGMENT_BATCH = 64;
+
+            /// The largest payload a UDP datagram can carry, which also limits a segmented send
+            constexpr std::size_t MAX_UDP_PAYLOAD = 65507;
+
+            /// How much of a fragmented packet is allocated before any of its data has arrived
+            constexpr std::size_t MAX_REASSEMBLY_RESERVE = 1 << 20;
 
         }  // namespace
 
@@ -464,23 +447,16 @@ namespace extension {
                 retransmit();
             }
 
-            // Used for storing how many bytes are available on a socket
-            unsigned long count = 0;  // NOLINT(google-runtime-int) MSVC wants an unsigned long
-
-            // Read packets from the multicast socket while there is data available
-            ioctl(announce_fd, FIONREAD, &(count = 0));
-            while (count > 0) {
-                auto packet = read_socket(announce_fd);
-                process_packet(packet.first, std::move(packet.second));
-                ioctl(announce_fd, FIONREAD, &(count = 0));
-            }
-
-            // Check if we have a packet available on the data socket
-            ioctl(data_fd, FIONREAD, &(count = 0));
-            while (count > 0) {
-                auto packet = read_socket(data_fd);
-                process_packet(packet.first, std::move(packet.second));
-                ioctl(data_fd, FIONREAD, &(count = 0));
+            // Drain each socket a batch at a time until it says there is nothing else waiting
+            for (const fd_t& fd : {announce_fd, data_fd}) {
+                bool more = true;
+                while (more) {
+                    const util::network::DatagramBatch batch = util::network::recv_datagrams(fd, false);
+                    for (const auto& packet : batch.datagrams) {
+                        process_packet(packet.remote, packet.data, packet.size);
+                    }
+                    more = batch.more;
+                }
             }
         }
 
@@ -516,12 +492,8 @@ namespace extension {
                                 next_event_callback(next_event);
                             }
 
-                            // Work out which packets to resend and resend them
-                            for (uint16_t i = 0; i < qit->second.header.packet_count; ++i) {
-                                if ((it->acked[i / 8] & uint8_t(1 << (i % 8))) == 0) {
-                                    send_packet(ptr->target, qit->second.header, i, qit->second.payload, true);
-                                }
-                            }
+                            // Resend the packets that haven't been acknowledged
+                            send_packets(ptr->target, qit->second.header, *qit->second.payload, it->acked);
                         }
 
                         ++it;
@@ -562,14 +534,14 @@ namespace extension {
             }
         }
 
-        void NUClearNetwork::process_packet(const sock_t& address, std::vector<uint8_t>&& payload) {
+        void NUClearNetwork::process_packet(const sock_t& address, const uint8_t* payload, const std::size_t& size) {
 
             // First validate this is a NUClear network packet we can read (a version 2 NUClear packet)
-            if (payload.size() >= sizeof(PacketHeader) && payload[0] == 0xE2 && payload[1] == 0x98 && payload[2] == 0xA2
+            if (size >= sizeof(PacketHeader) && payload[0] == 0xE2 && payload[1] == 0x98 && payload[2] == 0xA2
                 && payload[3] == 0x02) {
 
                 // This is a real packet! get our header information
-                const PacketHeader& header = *reinterpret_cast<const PacketHeader*>(payload.data());
+                const PacketHeader& header = *reinterpret_cast<const PacketHeader*>(payload);
 
                 // Get the map key for this device
                 auto key = udp_key(address);
@@ -587,11 +559,11 @@ namespace extension {
                     // A packet announcing that a user is on the network
                     case ANNOUNCE: {
                         // This is an announce packet!
-                        const AnnouncePacket& announce = *reinterpret_cast<const AnnouncePacket*>(payload.data());
+                        const AnnouncePacket& announce = *reinterpret_cast<const AnnouncePacket*>(payload);
 
                         // They're new!
                         if (!remote) {
-                            const std::string name(&announce.name, payload.size() - sizeof(AnnouncePacket));
+                            const std::string name(&announce.name, size - sizeof(AnnouncePacket));
 
                             // If they sent us an empty name ignore that's reserved for multicast transmissions
                             if (!name.empty()) {
@@ -657,12 +629,17 @@ namespace extension {
                     case DATA_RETRANSMISSION:
                     case DATA: {
 
+                        // Drop anything too short to hold the data header
+                        if (size < sizeof(DataPacket) - 1) {
+                            return;
+                        }
+
                         // It's a data packet
-                        const DataPacket& packet = *reinterpret_cast<const DataPacket*>(payload.data());
+                        const DataPacket& packet = *reinterpret_cast<const DataPacket*>(payload);
 
                         // If the packet is obviously corrupt, drop it and since we didn't ack it it'll be resent if
                         // it's important
-                        if (packet.packet_no > packet.packet_count) {
+                        if (packet.packet_no >= packet.packet_count) {
                             return;
                         }
 
@@ -719,7 +696,7 @@ namespace extension {
 
                                 // Copy our data into a vector
                                 std::vector<uint8_t> out(&packet.data,
-                                                         &packet.data + payload.size() - sizeof(DataPacket) + 1);
+                                                         &packet.data + size - sizeof(DataPacket) + 1);
 
                                 // If this is a reliable packet, send an ack back
                                 if (packet.reliable) {
@@ -756,10 +733,18 @@ namespace extension {
 
                                 auto& assembler = assemblers[packet.packet_id];
 
-                                // First check that our cache isn't super corrupted by ensuring that our last packet
-                                // in our list isn't after the number of packets we have
-                                if (!assembler.second.empty()
-                                    && std::next(assembler.second.end(), -1)->first >= packet.packet_count) {
+                                // The data in this fragment, every fragment but the last has the same amount
+                                const char* fragment      = &packet.data;
+                                const std::size_t length  = size - sizeof(DataPacket) + 1;
+                                const bool last           = packet.packet_no + 1 == packet.packet_count;
+                                const std::size_t& stride = assembler.fragment_size;
+
+                                // First check that our cache isn't corrupted by ensuring that this fragment agrees
+                                // with the fragments we already have
+                                if ((assembler.received_count > 0 || stride != 0)
+                                    && (assembler.packet_count != packet.packet_count
+                                        || (stride != 0 && (last ? length > stride : length != stride))
+                                        || (stride == 0 && !last && assembler.last.size() > length))) {
 
                                     // If so, we need to purge our cache and if this was a reliable packet, send a
                                     // NACK back for all the packets we thought we had
@@ -775,9 +760,10 @@ namespace extension {
                                         response.packet_count = packet.packet_count;
 
                                         // Set the bits for the packets we thought we received
-                                        for (const auto& p : assembler.second) {
-                                            (&response.packets)[p.first / 8] |= uint8_t(1 << (p.first % 8));
-                                        }
+                                        const std::size_t bytes = r.size() - sizeof(NACKPacket) + 1;
+                                        std::memcpy(&response.packets,
+                                                    assembler.received.data(),
+                                                    std::min(assembler.received.size(), bytes));
 
                                         // Ensure the bit for this packet isn't NACKed
                                         (&response.packets)[packet.packet_no / 8] &=
@@ -796,12 +782,56 @@ namespace extension {
                                     }
 
                                     // Clear our packets here (the one we just got will be added right after this)
-                                    assembler.second.clear();
+                                    assembler = NetworkTarget::Assembler();
+                                }
+
+                                // This is the first fragment we have for this packet
+                                if (assembler.received_count == 0) {
+                                    assembler.packet_count = packet.packet_count;
+                                    assembler.received.assign((packet.packet_count / 8) + 1, 0);
+                                }
+
+                                // The buffer only grows in step with the data that has actually arrived so a forged
+                                // fragment number can't make us allocate the whole of a huge packet. Anything further
+                                // ahead is dropped and resent like any other lost fragment, and nothing is kept from it
+                                if (!last && length > 0) {
+                                    const std::size_t fragment_size = stride != 0 ? stride : length;
+                                    const std::size_t end           = (packet.packet_no + 1) * fragment_size;
+                                    if (end > std::max(MAX_REASSEMBLY_RESERVE,
+                                                       2 * std::size_t(assembler.received_count) * fragment_size)) {
+                                        if (assembler.received_count == 0) {
+                                            assemblers.erase(packet.packet_id);
+                                        }
+                                        return;
+                                    }
+                                }
+
+                                // Once we know how big the fragments are we can start building the packet
+                                if (!last && stride == 0 && length > 0) {
+                                    assembler.fragment_size = length;
+                                    assembler.data.reserve(
+                                        std::min(packet.packet_count * stride, MAX_REASSEMBLY_RESERVE));
                                 }
 
-                                // Add our packet to our list of assemblers
-                                assembler.first                    = std::chrono::steady_clock::now();
-                                assembler.second[packet.packet_no] = std::move(payload);
+                                // Hold on to the last fragment until the rest of the packet is here
+                                if (last) {
+                                    assembler.last.assign(fragment, fragment + length);
+                                }
+                                else if (length > 0) {
+                                    const std::size_t end = (packet.packet_no + 1) * stride;
+                                    if (assembler.data.size() < end) {
+                                        assembler.data.resize(end);
+                                    }
+                                    std::memcpy(&assembler.data[packet.packet_no * stride], fragment, length);
+                                }
+
+                                // Mark it as received
+                                const uint8_t bit = uint8_t(1 << (packet.packet_no % 8));
+                                if ((assembler.received[packet.packet_no / 8] & bit) == 0) {
+                                    assembler.received[packet.packet_no / 8] |= bit;
+                                    ++assembler.received_count;
+                                }
+                                assembler.last_update = std::chrono::steady_clock::now();
 
                                 // Create and send our ACK packet if this is a reliable transmission
                                 if (packet.reliable) {
@@ -815,9 +845,9 @@ namespace extension {
                                     response.packet_count = packet.packet_count;
 
                                     // Set the bits for the packets we have received
-                                    for (const auto& p : assembler.second) {
-                                        (&response.packets)[p.first / 8] |= uint8_t(1 << (p.first % 8));
-                                    }
+                                    std::memcpy(&response.packets,
+                                                assembler.received.data(),
+                                                assembler.received.size());
 
                                     // Make who we are sending it to into a useable address
                                     const sock_t& to = remote->target;
@@ -831,28 +861,17 @@ namespace extension {
                                              to.size());
                                 }
 
-                                // Check to see if we have enough to assemble the whole thing
-                                if (assembler.second.size() == packet.packet_count) {
+                                // Check to see if we have the whole thing
+                                if (assembler.received_count == packet.packet_count) {
 
-                                    // Work out exactly how much data we will need first so we only need one
-                                    // allocation
-                                    size_t payload_size = 0;
-                                    for (const auto& p : assembler.second) {
-                                        payload_size += p.second.size() - sizeof(DataPacket) + 1;
-                                    }
-
-                                    // Read in our data
-                                    std::vector<uint8_t> out;
-                                    out.reserve(payload_size);
-                                    for (auto& p : assembler.second) {
-                                        const DataPacket& part = *reinterpret_cast<DataPacket*>(p.second.data());
-                                        out.insert(out.end(),
-                                                   &part.data,
-                                                   &part.data + p.second.size() - sizeof(DataPacket) + 1);
-                                    }
+                                    // Put the last fragment on the end
+                                    assembler.data.resize((packet.packet_count - 1) * stride);
+                                    assembler.data.insert(assembler.data.end(),
+                                                          assembler.last.begin(),
+                                                          assembler.last.end());
 
                                     // Send our assembled data packet
-                                    packet_callback(*remote, packet.hash, packet.reliable, std::move(out));
+                                    packet_callback(*remote, packet.hash, packet.reliable, std::move(assembler.data));
 
                                     // If the packet was reliable add that it was recently received
                                     if (packet.reliable) {
@@ -870,7 +889,7 @@ namespace extension {
                                 for (auto it = assemblers.begin(); it != assemblers.end();) {
                                     const auto now              = std::chrono::steady_clock::now();
                                     const auto timeout          = remote->round_trip_time * 10.0;
-                                    const auto& last_chunk_time = it->second.first;
+                                    const auto& last_chunk_time = it->second.last_update;
 
                                     it = now > last_chunk_time + timeout ? assemblers.erase(it) : std::next(it);
                                 }
@@ -882,7 +901,7 @@ namespace extension {
                     case ACK: {
 
                         // It's an ack packet
-                        const ACKPacket& packet = *reinterpret_cast<const ACKPacket*>(payload.data());
+                        const ACKPacket& packet = *reinterpret_cast<const ACKPacket*>(payload);
 
                         // Check if we know who this is and if we don't know them, ignore
                         if (remote) {
@@ -911,7 +930,7 @@ namespace extension {
                                     // Wrong packet
                                     && packet.packet_count == queue.header.packet_count
                                     // Truncated packet
-                                    && payload.size() == (sizeof(ACKPacket) + (queue.header.packet_count / 8))) {
+                                    && size == (sizeof(ACKPacket) + (queue.header.packet_count / 8))) {
 
                                     // Work out about how long our round trip time is
                                     auto now        = std::chrono::steady_clock::now();
@@ -954,7 +973,7 @@ namespace extension {
                     // Packet requesting a retransmission of some corrupt data
                     case NACK: {
                         // It's a nack packet
-                        const NACKPacket& packet = *reinterpret_cast<const NACKPacket*>(payload.data());
+                        const NACKPacket& packet = *reinterpret_cast<const NACKPacket*>(payload);
 
                         // Check if we know who this is and if we don't know them, ignore
                         if (remote) {
@@ -981,7 +1000,7 @@ namespace extension {
                                     // It's not corrupted
                                     && packet.packet_count == queue.header.packet_count
                                     // It's not truncated
-                                    && payload.size() == (sizeof(NACKPacket) + (queue.header.packet_count / 8))) {
+                                    && size == (sizeof(NACKPacket) + (queue.header.packet_count / 8))) {
 
                                     // Store the time as we are now sending new packets
                                     s->last_send = std::chrono::steady_clock::now();
@@ -1000,15 +1019,12 @@ namespace extension {
                                         s->acked[i] &= ~(&packet.packets)[i];
                                     }
 
-                                    // Now we have to retransmit the nacked packets
-                                    for (uint16_t i = 0; i < packet.packet_count * 8; ++i) {
-
-                                        // Check if this packet needs to be sent
-                                        const uint8_t bit = 1 << (i % 8);
-                                        if (((&packet.packets)[i] & bit) == bit) {
-                                            send_packet(remote->target, queue.header, i, queue.payload, true);
-                                        }
+                                    // Now we have to retransmit the nacked packets, so skip everything else
+                                    std::vector<uint8_t> skip(s->acked.size());
+                                    for (unsigned i = 0; i < skip.size(); ++i) {
+                                        skip[i] = uint8_t(~(&packet.packets)[i]);
                                     }
+                                    send_packets(remote->target, queue.header, *queue.payload, skip);
                                 }
                             }
                         }
@@ -1022,42 +1038,122 @@ namespace extension {
             return std::vector<fd_t>({data_fd, announce_fd});
         }
 
-        void NUClearNetwork::send_packet(const sock_t& target,
-                                         NUClear::extension::network::DataPacket header,
-                                         uint16_t packet_no,
-                                         const std::vector<uint8_t>& payload,
-                                         const bool& /*reliable*/) {
-
-            // Our packet we are sending
-            msghdr message{};
-
-            std::array<iovec, 2> data{};
-            message.msg_iov    = data.data();
-            message.msg_iovlen = 2;
+        void NUClearNetwork::send_packets(const sock_t& target,
+                                          const DataPacket& header,
+                                          const std::vector<uint8_t>& payload,
+                                          const std::vector<uint8_t>& skip) {
+
+            // A segmented send can't be larger than a single UDP datagram could be
+            const std::size_t fragment_size = sizeof(DataPacket) - 1 + packet_data_mtu;
+            const std::size_t max_segments  = std::max(std::size_t(1), MAX_UDP_PAYLOAD / fragment_size);
+            const std::size_t batch_size =
+                segment_offload ? std::min(MAX_FRAGMENT_BATCH, max_segments) : MAX_FRAGMENT_BATCH;
+
+            // Each fragment gets its own copy of the header so it can have its own packet number
+            std::array<DataPacket, MAX_FRAGMENT_BATCH> headers;
+            std::array<iovec, MAX_FRAGMENT_BATCH * 2> iov{};
+            std::size_t count = 0;
+
+            for (uint16_t i = 0; i < header.packet_count; ++i) {
+                if (!skip.empty() && (skip[i / 8] & uint8_t(1 << (i % 8))) != 0) {
+                    continue;
+                }
 
-            // Update our headers packet number and set it in the message
-            header.packet_no = packet_no;
-            data[0].iov_base = reinterpret_cast<char*>(&header);
-            data[0].iov_len  = sizeof(DataPacket) - 1;
+                headers[count]           = header;
+                headers[count].packet_no = i;
+                iov[count * 2].iov_base  = reinterpret_cast<char*>(&headers[count]);
+                iov[count * 2].iov_len   = sizeof(DataPacket) - 1;
+
+                // Work out what chunk of data we are sending
+                // const cast is fine as posix guarantees it won't be modified on a sendmsg
+                const char* start = reinterpret_cast<const char*>(payload.data()) + (i * packet_data_mtu);
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+                iov[count * 2 + 1].iov_base = const_cast<char*>(start);
+                iov[count * 2 + 1].iov_len =
+                    i + 1 < header.packet_count ? packet_data_mtu : payload.size() % packet_data_mtu;
+
+                if (++count == batch_size) {
+                    send_fragments(target, iov.data(), count);
+                    count = 0;
+                }
+            }
 
-            // Work out what chunk of data we are sending
-            // const cast is fine as posix guarantees it won't be modified on a sendmsg
-            const char* start = reinterpret_cast<const char*>(payload.data()) + (packet_no * packet_data_mtu);
-            data[1].iov_base  = const_cast<char*>(start);  // NOLINT(cppcoreguidelines-pro-type-const-cast)
-            data[1].iov_len = packet_no + 1 < header.packet_count ? packet_data_mtu : payload.size() % packet_data_mtu;
+            if (count > 0) {
+                send_fragments(target, iov.data(), count);
+            }
+        }
 
-            // Set our target and send (once again const cast is fine)
-            message.msg_name    = const_cast<sockaddr*>(&target.sock);  // NOLINT(cppcoreguidelines-pro-type-const-cast)
-            message.msg_namelen = target.size();
+        void NUClearNetwork::send_fragments(const sock_t& target, iovec* iov, const std::size_t& count) {
 
             // TODO(trent): if reliable, run select first to see if this socket is writeable
             // If it is not reliable just don't send the message instead of blocking
-            sendmsg(data_fd, &message, 0);
-        }
 
+            // Once again const cast is fine as posix guarantees it won't be modified on a sendmsg
+            auto* name = const_cast<sockaddr*>(&target.sock);  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+
+#ifdef __linux__
+    #ifdef UDP_SEGMENT
+            // Every fragment but the last is full sized, so the kernel can split one long send back into fragments
+            if (segment_offload && count > 1) {
+                alignas(cmsghdr) std::array<char, CMSG_SPACE(sizeof(uint16_t))> control{};
+
+                msghdr message{};
+                message.msg_name       = name;
+                message.msg_namelen    = target.size();
+                message.msg_iov        = iov;
+                message.msg_iovlen     = count * 2;
+                message.msg_control    = control.data();
+                message.msg_controllen = control.size();
+
+                const uint16_t segment = uint16_t(sizeof(DataPacket) - 1 + packet_data_mtu);
+                cmsghdr* cmsg          = CMSG_FIRSTHDR(&message);
+                cmsg->cmsg_level       = SOL_UDP;
+                cmsg->cmsg_type        = UDP_SEGMENT;
+                cmsg->cmsg_len         = CMSG_LEN(sizeof(segment));
+                std::memcpy(CMSG_DATA(cmsg), &segment, sizeof(segment));
+
+                if (::sendmsg(data_fd, &message, 0) >= 0) {
+                    return;
+                }
+
+                // If the kernel or the device can't segment this send then stop trying, otherwise the fragments are
+                // dropped like any other failed send would be
+                if (errno != EINVAL && errno != EIO && errno != ENOPROTOOPT && errno != EOPNOTSUPP) {
+                    return;
+                }
+                segment_offload = false;
+            }
+    #endif
+
+            std::array<mmsghdr, MAX_FRAGMENT_BATCH> messages{};
+            for (std::size_t i = 0; i < count; ++i) {
+                msghdr& message     = messages[i].msg_hdr;
+                message.msg_name    = name;
+                message.msg_namelen = target.size();
+                message.msg_iov     = &iov[i * 2];
+                message.msg_iovlen  = 2;
+            }
+
+            // A fragment that fails stops the call at that fragment, so skip over it and carry on with the rest
+            std::size_t sent = 0;
+            while (sent < count) {
+                const int result = ::sendmmsg(data_fd, &messages[sent], static_cast<unsigned int>(count - sent), 0);
+                sent += result > 0 ? std::size_t(result) : 1;
+            }
+#else
+            for (std::size_t i = 0; i < count; ++i) {
+                msghdr message{};
+                message.msg_name    = name;
+                message.msg_namelen = target.size();
+                message.msg_iov     = &iov[i * 2];
+                message.msg_iovlen  = 2;
+                sendmsg(data_fd, &message, 0);
+            }
+#endif
+        }
 
         void NUClearNetwork::send(const uint64_t& hash,
-                                  const std::vector<uint8_t>& payload,
+                                  const std::shared_ptr<const std::vector<uint8_t>>& payload,
                                   const std::string& target,
                                   bool reliable) {
 
@@ -1078,7 +1174,7 @@ namespace extension {
             }
 
             header.packet_no    = 0;
-            header.packet_count = uint16_t((payload.size() / packet_data_mtu) + 1);
+            header.packet_count = uint16_t((payload->size() / packet_data_mtu) + 1);
             header.reliable     = reliable;
             header.hash         = hash;
 
@@ -1094,8 +1190,7 @@ namespace extension {
                 // overtransmitted
                 queue.header      = header;
                 queue.header.type = DATA_RETRANSMISSION;
-                // TODO(trent): there might be some better memory management that can happen here
-                queue.payload = payload;
+                queue.payload     = payload;
                 const std::vector<uint8_t> acks((header.packet_count / 8) + 1, 0);
 
                 // Find interested parties or if multicast it's everyone we are connected to
@@ -1122,10 +1217,8 @@ namespace extension {
 
                 // Now send all our packets to our targets
                 auto send_to = name_target.equal_range(target);
-                for (uint16_t i = 0; i < header.packet_count; ++i) {
-                    for (auto s = send_to.first; s != send_to.second; ++s) {
-                        send_packet(s->second->target, header, i, payload, reliable);
-                    }
+                for (auto s = send_to.first; s != send_to.second; ++s) {
+                    send_packets(s->second->target, header, *payload);
                 }
             }
         }
@@ -26,6 +26,7 @@
 #include <array>
 #include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <limits>
@@ -72,12 +73,34 @@ namespace extension {
                 std::array<int, std::numeric_limits<uint8_t>::max()> recent_packets{};
                 /// An index for the recent_packets (circular buffer)
                 std::atomic<uint8_t> recent_packets_index{0};
+                /**
+                 * A fragmented packet that is being put back together.
+                 *
+                 * Every fragment except the last carries the same amount of data, so once one of them has arrived each
+                 * fragment is written straight to its place in a single buffer. The buffer only grows as far as the data
+                 * that has actually arrived allows, and the last fragment is kept aside until the rest is here.
+                 */
+                struct Assembler {
+                    /// When we last received a fragment of this packet
+                    std::chrono::steady_clock::time_point last_update;
+                    /// How many fragments the packet was split into
+                    uint16_t packet_count{0};
+                    /// How many different fragments have arrived
+                    uint16_t received_count{0};
+                    /// A bitset of the fragments that have arrived
+                    std::vector<uint8_t> received;
+                    /// The amount of data in every fragment but the last, or 0 until one of them has arrived
+                    std::size_t fragment_size{0};
+                    /// The packet data up to the end of the furthest fragment that has arrived, minus the last
+                    std::vector<uint8_t> data;
+                    /// The last fragment, kept aside until the rest of the packet has arrived
+                    std::vector<uint8_t> last;
+                };
+
                 /// Mutex to protect the fragmented packet storage
                 std::mutex assemblers_mutex;
                 /// Storage for fragmented packets while we build them
-                std::map<uint16_t,
-                         std::pair<std::chrono::steady_clock::time_point, std::map<uint16_t, std::vector<uint8_t>>>>
-                    assemblers;
+                std::map<uint16_t, Assembler> assemblers;
 
                 /// Struct storing the kalman filter for round trip time
                 struct RoundTripKF {
@@ -126,13 +149,16 @@ namespace extension {
             /**
              * Send data using the NUClear network.
              *
+             * Reliable sends keep a reference to the payload until every target has acknowledged it, so it must not be
+             * modified after it is sent.
+             *
              * @param hash     The identifying hash for the data
-             * @param data     The bytes that are to be sent
+             * @param payload  The bytes that are to be sent
              * @param target   Who we are sending to (blank means everyone)
              * @param reliable If the delivery of the data should be ensured
              */
             void send(const uint64_t& hash,
-                      const std::vector<uint8_t>& payload,
+                      const std::shared_ptr<const std::vector<uint8_t>>& payload,
                       const std::string& target,
                       bool reliable);
 
@@ -234,8 +260,8 @@ namespace extension {
                 /// The header of the packet to send
                 DataPacket header;
 
-                /// The data to send
-                std::vector<uint8_t> payload;
+                /// The data to send, shared with the emit that created it
+                std::shared_ptr<const std::vector<uint8_t>> payload;
             };
 
             /**
@@ -256,10 +282,13 @@ namespace extension {
             /**
              * Processes the given packet and calls the callback if a packet was completed.
              *
+             * The payload is only valid for the duration of the call, anything that is kept is copied out of it.
+             *
              * @param address Who the packet came from
-             * @param data    The data that was sent in this packet
+             * @param payload The data that was sent in this packet
+             * @param size    The number of bytes in the payload
              */
-            void process_packet(const sock_t& address, std::vector<uint8_t>&& payload);
+            void process_packet(const sock_t& address, const uint8_t* payload, const std::size_t& size);
 
             /**
              * Send an announce packet to our announce address.
@@ -272,19 +301,32 @@ namespace extension {
             void retransmit();
 
             /**
-             * Send an individual packet to an individual target.
+             * Send the fragments of a packet to an individual target.
+             *
+             * Fragments are sent in batches, each fragment's header and its slice of the payload are passed to the
+             * kernel separately so the payload is never copied.
+             *
+             * @param target  The target to send the fragments to
+             * @param header  The header for this packet
+             * @param payload The data bytes for the entire packet
+             * @param skip    A bitset of fragments not to send, or empty to send every fragment
+             */
+            void send_packets(const sock_t& target,
+                              const DataPacket& header,
+                              const std::vector<uint8_t>& payload,
+                              const std::vector<uint8_t>& skip = {});
+
+            /**
+             * Send a batch of fragments to an individual target.
+             *
+             * On Linux the batch is sent as a single UDP GSO send when the kernel allows it, or with one sendmmsg
+             * call when it doesn't. Either way every fragment arrives as its own datagram.
              *
-             * @param target    The target to send the packet to
-             * @param header    The header for this packet
-             * @param packet_no The packet number we are sending
-             * @param payload   The data bytes for the entire packet
-             * @param reliable  If the packet is reliable (don't drop)
+             * @param target The target to send the fragments to
+             * @param iov    A header and a slice of the payload for each fragment
+             * @param count  The number of fragments in the batch
              */
-            void send_packet(const sock_t& target,
-                             DataPacket header,
-                             uint16_t packet_no,
-                             const std::vector<uint8_t>& payload,
-                             const bool& reliable);
+            void send_fragments(const sock_t& target, iovec* iov, const std::size_t& count);
 
             /**
              * Get the map key for this socket address.
@@ -309,6 +351,8 @@ namespace extension {
 
             /// The largest packet of data we will transmit, based on our IP version and MTU
             uint16_t packet_data_mtu{1000};
+            /// If fragments can be segmented by the kernel, cleared the first time it refuses a segmented send
+            std::atomic<bool> segment_offload{true};
 
             // Our announce packet
             std::vector<uint8_t> announce_packet;
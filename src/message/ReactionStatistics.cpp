@@ -24,7 +24,6 @@
 
 #include <chrono>
 #include <memory>
-#include <set>
 #include <thread>
 #include <utility>
 
@@ -54,7 +53,7 @@ namespace message {
                                            const IDPair& cause,
                                            const IDPair& target,
                                            std::shared_ptr<const util::ThreadPoolDescriptor> target_pool,
-                                           std::set<std::shared_ptr<const util::GroupDescriptor>> target_groups)
+                                           util::GroupDescriptorSet target_groups)
         : identifiers(std::move(identifiers))
         , cause(cause)
         , target(target)
@@ -25,12 +25,12 @@
 
 #include <exception>
 #include <memory>
-#include <set>
 #include <string>
 #include <thread>
 
 #include "../clock.hpp"
 #include "../id.hpp"
+#include "../util/GroupDescriptorSet.hpp"
 #include "../util/usage_clock.hpp"
 
 namespace NUClear {
@@ -80,7 +80,7 @@ namespace message {
                            const IDPair& cause,
                            const IDPair& target,
                            std::shared_ptr<const util::ThreadPoolDescriptor> target_pool,
-                           std::set<std::shared_ptr<const util::GroupDescriptor>> target_groups);
+                           util::GroupDescriptorSet target_groups);
 
         /// The identifiers for the reaction that was executed
         std::shared_ptr<const threading::ReactionIdentifiers> identifiers;
@@ -93,7 +93,7 @@ namespace message {
         /// The thread pool that this reaction was intended to run on
         std::shared_ptr<const util::ThreadPoolDescriptor> target_pool;
         /// The groups that this reaction was intended to run in
-        std::set<std::shared_ptr<const util::GroupDescriptor>> target_groups;
+        util::GroupDescriptorSet target_groups;
 
         /// The time and thread information for when this reaction was created
         Event created;
@@ -23,6 +23,7 @@
 #ifndef NUCLEAR_THREADING_REACTION_HPP
 #define NUCLEAR_THREADING_REACTION_HPP
 
+#include <array>
 #include <atomic>
 #include <functional>
 #include <memory>
@@ -45,6 +46,7 @@ namespace threading {
     class ReactionTask;
     struct ReactionIdentifiers;
     namespace scheduler {
+        class Group;
         class Pool;
         class Scheduler;
     }  // namespace scheduler
@@ -152,6 +154,18 @@ namespace threading {
         /// on the atomic (no data race); a reader either sees nullptr (and re-resolves) or the
         /// cached pointer.
         std::atomic<scheduler::Pool*> scheduler_data{nullptr};
+
+        /// The number of groups a reaction keeps resolved Group pointers for
+        static constexpr std::size_t GROUP_CACHE_SIZE = 4;
+
+        /// Cached scheduler-private pointers to the groups this reaction's tasks lock.
+        ///
+        /// Like scheduler_data this lets the scheduler skip the mutex-protected group lookup on every submit.
+        /// Entry i caches the Group for the i-th group descriptor of a task. Groups remember their descriptor, so
+        /// the scheduler checks the cached Group's descriptor matches before using it and re-resolves it if not,
+        /// which keeps reactions whose groups change from task to task correct.
+        /// Groups are never destroyed before the Scheduler, so the non-owning pointers stay valid.
+        std::array<std::atomic<scheduler::Group*>, GROUP_CACHE_SIZE> group_data{};
         friend class scheduler::Scheduler;  /// Let the scheduler mess with reaction objects
     };
 
@@ -30,6 +30,7 @@
 #include "../id.hpp"
 #include "../message/ReactionStatistics.hpp"
 #include "Reaction.hpp"
+#include "TaskAllocator.hpp"
 
 namespace NUClear {
 namespace threading {
@@ -85,11 +86,13 @@ namespace threading {
         const auto target_reaction_id = parent != nullptr ? parent->id : 0;
         const auto target_task_id     = id;
 
-        return std::make_shared<message::ReactionStatistics>(identifiers,
-                                                             IDPair{cause_reaction_id, cause_task_id},
-                                                             IDPair{target_reaction_id, target_task_id},
-                                                             pool_descriptor,
-                                                             group_descriptors);
+        using StatisticsAllocator = TaskAllocator::Allocator<message::ReactionStatistics>;
+        return std::allocate_shared<message::ReactionStatistics>(StatisticsAllocator(),
+                                                                 identifiers,
+                                                                 IDPair{cause_reaction_id, cause_task_id},
+                                                                 IDPair{target_reaction_id, target_task_id},
+                                                                 pool_descriptor,
+                                                                 group_descriptors);
     }
 
     // Initialize our current task
@@ -25,14 +25,20 @@
 
 #include <functional>
 #include <memory>
-#include <set>
 
 #include "../clock.hpp"
 #include "../id.hpp"
-#include "../util/GroupDescriptor.hpp"
+#include "../util/GroupDescriptorSet.hpp"
 #include "../util/Inline.hpp"
+#include "../util/InlineFunction.hpp"
 #include "../util/ThreadPoolDescriptor.hpp"
 #include "Reaction.hpp"
+#include "TaskAllocator.hpp"
+
+// The number of bytes a ReactionTask can hold its callback in before it has to allocate it elsewhere
+#ifndef NUCLEAR_TASK_INLINE_CAPACITY
+    #define NUCLEAR_TASK_INLINE_CAPACITY 96
+#endif
 
 namespace NUClear {
 
@@ -56,7 +62,10 @@ namespace threading {
 
     public:
         /// Type of the functions that ReactionTasks execute
-        using TaskFunction = std::function<void(ReactionTask&)>;
+        /// Callbacks that don't fit in NUCLEAR_TASK_INLINE_CAPACITY bytes are allocated from the TaskAllocator
+        using TaskFunction = util::InlineFunction<void(ReactionTask&),
+                                                  NUCLEAR_TASK_INLINE_CAPACITY,
+                                                  TaskAllocator::Allocator<char>>;
 
         /**
          * Gets the current executing task, or nullptr if there isn't one.
@@ -102,6 +111,28 @@ namespace threading {
             }
         }
 
+        /**
+         * Allocates tasks from the calling thread's TaskAllocator freelist rather than the global heap.
+         *
+         * @param size the size of the task
+         *
+         * @return the memory for the task
+         */
+        static void* operator new(std::size_t size) {
+            TaskAllocator::count_task();
+            return TaskAllocator::allocate(size);
+        }
+
+        /**
+         * Returns a task's memory to the TaskAllocator, this may happen on a different thread to the allocation.
+         *
+         * @param ptr  the memory for the task
+         * @param size the size of the task
+         */
+        static void operator delete(void* ptr, std::size_t size) noexcept {
+            TaskAllocator::deallocate(ptr, size);
+        }
+
         // No copying or moving of tasks (use unique_ptrs to manage tasks)
         ReactionTask(const ReactionTask&)            = delete;
         ReactionTask& operator=(const ReactionTask&) = delete;
@@ -142,7 +173,7 @@ namespace threading {
         /// the tasks will be queued on
         std::shared_ptr<const util::ThreadPoolDescriptor> pool_descriptor;
         /// Details about the groups that this task will run in
-        std::set<std::shared_ptr<const util::GroupDescriptor>> group_descriptors;
+        util::GroupDescriptorSet group_descriptors;
 
         /// The statistics object that records run details about this reaction task
         /// This will be nullptr if this task is ineligible to emit stats (e.g. it would cause a loop)
@@ -0,0 +1,353 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "TaskAllocator.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace NUClear {
+namespace threading {
+
+    namespace {
+
+        struct Cache;
+
+        /// Sits in front of every block so a free on any thread can find the cache the block belongs to
+        struct alignas(alignof(std::max_align_t)) Header {
+            /// The cache that owns this block, or nullptr if the block belongs to the global heap
+            Cache* owner;
+        };
+
+        /// The view of a block while it is sitting in a freelist
+        struct Block {
+            Block* next;
+        };
+
+        /**
+         * The freelists that belong to one thread.
+         *
+         * Only the owning thread touches the local lists and the outgoing batch.
+         * Other threads hand blocks back by pushing them onto the remote lists, which the owner takes all at once.
+         */
+        struct Cache {
+            Cache() {
+                for (auto& r : remote) {
+                    r.store(nullptr, std::memory_order_relaxed);
+                }
+            }
+
+            /// Blocks that are ready to be handed out by the owning thread
+            std::array<Block*, TaskAllocator::SIZE_CLASSES> local{};
+            /// How many blocks are in each local list, used to limit how much memory a thread holds on to
+            std::array<std::size_t, TaskAllocator::SIZE_CLASSES> local_count{};
+            /// Blocks that were freed by other threads and are waiting to be collected by the owner
+            std::array<std::atomic<Block*>, TaskAllocator::SIZE_CLASSES> remote;
+
+            /// The cache that the blocks in the outgoing batch belong to
+            Cache* batch_owner{nullptr};
+            /// The first block of the outgoing batch for each size class
+            std::array<Block*, TaskAllocator::SIZE_CLASSES> batch_head{};
+            /// The last block of the outgoing batch for each size class
+            std::array<Block*, TaskAllocator::SIZE_CLASSES> batch_tail{};
+            /// The number of blocks in the outgoing batch
+            std::size_t batch_size{0};
+
+            /// The counters for the statistics, written only by the owning thread
+            std::atomic<uint64_t> tasks{0};
+            std::atomic<uint64_t> requests{0};
+            std::atomic<uint64_t> heap_allocations{0};
+            std::atomic<uint64_t> spilled_callbacks{0};
+        };
+
+        /// Every cache that has been created, and the caches whose threads have exited and can be reused
+        struct Registry {
+            std::mutex mutex;
+            std::vector<Cache*> all;
+            std::vector<Cache*> orphans;
+        };
+
+        Registry& registry() {
+            // Blocks hold raw pointers to their cache, so caches (and the registry) are never destroyed
+            static Registry* instance = new Registry();  // NOLINT(cppcoreguidelines-owning-memory)
+            return *instance;
+        }
+
+        void increment(std::atomic<uint64_t>& counter) noexcept {
+            // Only the owning thread writes the counters so this doesn't need to be an atomic read-modify-write
+            counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+
+        Block* to_block(Header* header) noexcept {
+            return reinterpret_cast<Block*>(header + 1);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        }
+
+        Header* to_header(void* ptr) noexcept {
+            return reinterpret_cast<Header*>(ptr) - 1;  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        }
+
+        std::size_t size_class(const std::size_t& size) noexcept {
+            return size == 0 ? 0 : (size - 1) / TaskAllocator::CLASS_GRANULARITY;
+        }
+
+        /**
+         * Hand the outgoing batch back to the cache it belongs to.
+         *
+         * @param cache the cache whose outgoing batch should be flushed
+         */
+        void flush(Cache& cache) noexcept {
+            if (cache.batch_owner == nullptr) {
+                return;
+            }
+
+            for (std::size_t i = 0; i < TaskAllocator::SIZE_CLASSES; ++i) {
+                if (cache.batch_head[i] != nullptr) {
+                    auto& target = cache.batch_owner->remote[i];
+                    Block* head  = target.load(std::memory_order_relaxed);
+                    do {
+                        cache.batch_tail[i]->next = head;
+                    } while (!target.compare_exchange_weak(head,
+                                                           cache.batch_head[i],
+                                                           std::memory_order_release,
+                                                           std::memory_order_relaxed));
+                    cache.batch_head[i] = nullptr;
+                    cache.batch_tail[i] = nullptr;
+                }
+            }
+            cache.batch_owner = nullptr;
+            cache.batch_size  = 0;
+        }
+
+        /**
+         * Take the blocks other threads have returned as the local list, which must be empty.
+         *
+         * Blocks past the most a thread holds on to go back to the heap.
+         *
+         * @param cache the cache to refill
+         * @param cls   the size class to refill
+         */
+        void adopt_remote(Cache& cache, const std::size_t& cls) noexcept {
+            Block* head = cache.remote[cls].exchange(nullptr, std::memory_order_acquire);
+
+            std::size_t count = 0;
+            Block* last       = nullptr;
+            for (Block* b = head; b != nullptr && count < TaskAllocator::MAX_LOCAL_BLOCKS; b = b->next) {
+                last = b;
+                ++count;
+            }
+            if (last != nullptr) {
+                Block* excess = last->next;
+                last->next    = nullptr;
+                while (excess != nullptr) {
+                    Block* next = excess->next;
+                    ::operator delete(to_header(excess));
+                    excess = next;
+                }
+            }
+
+            cache.local[cls]       = head;
+            cache.local_count[cls] = count;
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+        thread_local Cache* current_cache = nullptr;
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+        thread_local bool thread_exited = false;
+
+        /// Gives the thread's cache to the orphan list when the thread exits so a future thread can reuse it
+        struct ThreadCache {
+            ThreadCache()                              = default;
+            ThreadCache(const ThreadCache&)            = delete;
+            ThreadCache(ThreadCache&&)                 = delete;
+            ThreadCache& operator=(const ThreadCache&) = delete;
+            ThreadCache& operator=(ThreadCache&&)      = delete;
+            ~ThreadCache() {
+                if (current_cache != nullptr) {
+                    flush(*current_cache);
+                    auto& r = registry();
+                    const std::lock_guard<std::mutex> lock(r.mutex);
+                    r.orphans.push_back(current_cache);
+                }
+                current_cache = nullptr;
+                thread_exited = true;
+            }
+
+            /// Set once this thread has a cache, this also makes sure the destructor is registered
+            bool registered{false};
+        };
+
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+        thread_local ThreadCache thread_cache;
+
+        /**
+         * Get the cache for the current thread, creating or adopting one if needed.
+         *
+         * @return the cache for this thread, or nullptr if the thread is exiting
+         */
+        Cache* local_cache() {
+            if (current_cache != nullptr || thread_exited) {
+                return current_cache;
+            }
+
+            auto& r      = registry();
+            Cache* cache = nullptr;
+            {
+                const std::lock_guard<std::mutex> lock(r.mutex);
+                if (!r.orphans.empty()) {
+                    cache = r.orphans.back();
+                    r.orphans.pop_back();
+                }
+                else {
+                    cache = new Cache();  // NOLINT(cppcoreguidelines-owning-memory)
+                    r.all.push_back(cache);
+                }
+            }
+
+            thread_cache.registered = true;
+            current_cache           = cache;
+            return cache;
+        }
+
+    }  // namespace
+
+    void* TaskAllocator::allocate(std::size_t size) {
+        Cache* cache          = local_cache();
+        const std::size_t cls = size_class(size);
+
+        if (cache != nullptr) {
+            increment(cache->requests);
+
+            if (cls < SIZE_CLASSES) {
+                // Take from our local list, and refill it from the blocks other threads have returned if it is empty
+                if (cache->local[cls] == nullptr && cache->remote[cls].load(std::memory_order_relaxed) != nullptr) {
+                    adopt_remote(*cache, cls);
+                }
+                Block* block = cache->local[cls];
+                if (block != nullptr) {
+                    cache->local[cls] = block->next;
+                    cache->local_count[cls]--;
+                    return block;
+                }
+                size = (cls + 1) * CLASS_GRANULARITY;
+            }
+            increment(cache->heap_allocations);
+        }
+
+        auto* header  = static_cast<Header*>(::operator new(sizeof(Header) + size));
+        header->owner = cls < SIZE_CLASSES ? cache : nullptr;
+        return to_block(header);
+    }
+
+    void TaskAllocator::deallocate(void* ptr, std::size_t size) noexcept {
+        if (ptr == nullptr) {
+            return;
+        }
+
+        Header* header = to_header(ptr);
+        Cache* owner   = header->owner;
+
+        // Blocks that aren't from a freelist go straight back to the heap
+        if (owner == nullptr) {
+            ::operator delete(header);
+            return;
+        }
+
+        const std::size_t cls = size_class(size);
+        auto* block           = static_cast<Block*>(ptr);
+        Cache* cache          = current_cache;
+
+        // Our own block goes back on our local list unless we are already holding enough
+        if (cache == owner) {
+            if (cache->local_count[cls] >= MAX_LOCAL_BLOCKS) {
+                ::operator delete(header);
+                return;
+            }
+            block->next       = cache->local[cls];
+            cache->local[cls] = block;
+            cache->local_count[cls]++;
+            return;
+        }
+
+        // A thread without a cache can't batch, so it returns the block on its own
+        if (cache == nullptr) {
+            auto& target = owner->remote[cls];
+            Block* head  = target.load(std::memory_order_relaxed);
+            do {
+                block->next = head;
+            } while (!target.compare_exchange_weak(head, block, std::memory_order_release, std::memory_order_relaxed));
+            return;
+        }
+
+        // Add it to the outgoing batch, which only ever holds blocks for a single owner
+        if (cache->batch_owner != owner) {
+            flush(*cache);
+            cache->batch_owner = owner;
+        }
+        block->next = cache->batch_head[cls];
+        if (cache->batch_tail[cls] == nullptr) {
+            cache->batch_tail[cls] = block;
+        }
+        cache->batch_head[cls] = block;
+        if (++cache->batch_size >= REMOTE_BATCH) {
+            flush(*cache);
+        }
+    }
+
+    void TaskAllocator::flush_remote() noexcept {
+        if (current_cache != nullptr) {
+            flush(*current_cache);
+        }
+    }
+
+    void TaskAllocator::count_task() {
+        Cache* cache = local_cache();
+        if (cache != nullptr) {
+            increment(cache->tasks);
+        }
+    }
+
+    void TaskAllocator::count_spilled_callback() {
+        Cache* cache = local_cache();
+        if (cache != nullptr) {
+            increment(cache->spilled_callbacks);
+        }
+    }
+
+    TaskAllocator::Statistics TaskAllocator::statistics() {
+        Statistics stats;
+        auto& r = registry();
+        const std::lock_guard<std::mutex> lock(r.mutex);
+        for (const auto* cache : r.all) {
+            stats.tasks += cache->tasks.load(std::memory_order_relaxed);
+            stats.requests += cache->requests.load(std::memory_order_relaxed);
+            stats.heap_allocations += cache->heap_allocations.load(std::memory_order_relaxed);
+            stats.spilled_callbacks += cache->spilled_callbacks.load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
+}  // namespace threading
+}  // namespace NUClear
@@ -0,0 +1,150 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NUCLEAR_THREADING_TASK_ALLOCATOR_HPP
+#define NUCLEAR_THREADING_TASK_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace NUClear {
+namespace threading {
+
+    /**
+     * Allocates the small objects that are created for every reaction task.
+     *
+     * Each thread keeps a freelist of blocks for each size class, so once a program reaches a steady state creating
+     * and destroying tasks doesn't touch the global heap.
+     * Blocks remember the thread that allocated them. A block freed on a different thread is collected into a batch
+     * and the whole batch is handed back to the owning thread with a single atomic operation, where it is reused the
+     * next time that thread runs out of local blocks.
+     *
+     * Requests larger than the biggest size class go straight to the global heap.
+     */
+    class TaskAllocator {
+    public:
+        /// The number of size classes that are served from the freelists
+        static constexpr std::size_t SIZE_CLASSES = 8;
+        /// The size increment between each size class
+        static constexpr std::size_t CLASS_GRANULARITY = 64;
+        /// The number of blocks freed on another thread that are collected before handing them back to their owner
+        static constexpr std::size_t REMOTE_BATCH = 32;
+        /// The most blocks of a single size class a thread will hold on to before returning them to the heap
+        static constexpr std::size_t MAX_LOCAL_BLOCKS = 4096;
+
+        /**
+         * Counters describing how the allocator has been used since the program started.
+         *
+         * Dividing heap_allocations by tasks gives the number of allocations made per task.
+         * Once a program reaches a steady state heap_allocations should stop increasing.
+         */
+        struct Statistics {
+            /// The number of reaction tasks that have been created
+            uint64_t tasks{0};
+            /// The number of allocation requests made to the allocator
+            uint64_t requests{0};
+            /// The number of those requests that had to go to the global heap
+            uint64_t heap_allocations{0};
+            /// The number of tasks whose callback was too big to be stored inside the task
+            uint64_t spilled_callbacks{0};
+        };
+
+        /**
+         * Allocate a block of at least the given size.
+         *
+         * @param size the number of bytes needed
+         *
+         * @return a pointer to the allocated memory, aligned for any standard type
+         */
+        static void* allocate(std::size_t size);
+
+        /**
+         * Return a block that was allocated with allocate().
+         *
+         * This may be called from any thread.
+         *
+         * @param ptr  the pointer returned by allocate()
+         * @param size the size that was passed to allocate()
+         */
+        static void deallocate(void* ptr, std::size_t size) noexcept;
+
+        /**
+         * Hand the blocks this thread has freed for other threads back to them now, rather than once a batch is full.
+         *
+         * A thread that is about to sleep calls this so the blocks it is holding aren't stranded until it wakes up.
+         */
+        static void flush_remote() noexcept;
+
+        /**
+         * Record that a reaction task was created, for the allocations per task statistic.
+         */
+        static void count_task();
+
+        /**
+         * Record that a reaction task's callback didn't fit inside the task and had to be allocated separately.
+         */
+        static void count_spilled_callback();
+
+        /**
+         * Sums the counters from every thread that has used the allocator.
+         *
+         * @return the combined statistics
+         */
+        static Statistics statistics();
+
+        /**
+         * A standard allocator that gets its memory from the TaskAllocator.
+         *
+         * This can be used with std::allocate_shared so the object and its control block come from the freelists.
+         *
+         * @tparam T the type being allocated
+         */
+        template <typename T>
+        struct Allocator {
+            using value_type = T;
+
+            Allocator() = default;
+            template <typename U>
+            Allocator(const Allocator<U>& /*other*/) noexcept {}  // NOLINT(google-explicit-constructor)
+
+            T* allocate(std::size_t n) {
+                return static_cast<T*>(TaskAllocator::allocate(n * sizeof(T)));
+            }
+            void deallocate(T* ptr, std::size_t n) noexcept {
+                TaskAllocator::deallocate(ptr, n * sizeof(T));
+            }
+
+            template <typename U>
+            friend bool operator==(const Allocator& /*lhs*/, const Allocator<U>& /*rhs*/) noexcept {
+                return true;
+            }
+            template <typename U>
+            friend bool operator!=(const Allocator& /*lhs*/, const Allocator<U>& /*rhs*/) noexcept {
+                return false;
+            }
+        };
+    };
+
+}  // namespace threading
+}  // namespace NUClear
+
+#endif  // NUCLEAR_THREADING_TASK_ALLOCATOR_HPP
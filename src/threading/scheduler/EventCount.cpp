@@ -0,0 +1,122 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "EventCount.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+#if defined(__linux__)
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#else
+    #include <condition_variable>
+    #include <mutex>
+#endif
+
+namespace NUClear {
+namespace threading {
+    namespace scheduler {
+
+        EventCount::Key EventCount::prepare_wait() noexcept {
+            waiters.fetch_add(1, std::memory_order_seq_cst);
+            // Pairs with the fence in notify so either we see the notifier's change when we re-check our condition
+            // or the notifier sees us waiting
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            return epoch.load(std::memory_order_acquire);
+        }
+
+        void EventCount::cancel_wait() noexcept {
+            waiters.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+#if defined(__linux__)
+
+        void EventCount::wait(const Key& key) noexcept {
+            // std::atomic<uint32_t> has the same representation as uint32_t so the futex can wait on it directly
+            auto* address = reinterpret_cast<uint32_t*>(&epoch);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            while (epoch.load(std::memory_order_acquire) == key) {
+                // Returns immediately if the epoch has already moved on, and spurious wakeups are handled by the loop
+                ::syscall(SYS_futex, address, FUTEX_WAIT_PRIVATE, key, nullptr, nullptr, 0);
+            }
+            waiters.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        void EventCount::notify(const uint32_t& n) noexcept {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (n == 0 || waiters.load(std::memory_order_relaxed) == 0) {
+                return;
+            }
+
+            epoch.fetch_add(1, std::memory_order_acq_rel);
+            auto* address = reinterpret_cast<uint32_t*>(&epoch);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            const int count = n > uint32_t(INT32_MAX) ? INT32_MAX : int(n);
+            ::syscall(SYS_futex, address, FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+        }
+
+#else
+
+        void EventCount::wait(const Key& key) noexcept {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [&] { return epoch.load(std::memory_order_acquire) != key; });
+            lock.unlock();
+            waiters.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        void EventCount::notify(const uint32_t& n) noexcept {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (n == 0 || waiters.load(std::memory_order_relaxed) == 0) {
+                return;
+            }
+
+            epoch.fetch_add(1, std::memory_order_acq_rel);
+            // Taking the mutex orders the epoch change against a waiter that has checked it but not yet slept
+            /*mutex scope*/ {
+                const std::lock_guard<std::mutex> lock(mutex);
+            }
+            if (n >= waiters.load(std::memory_order_relaxed)) {
+                condition.notify_all();
+            }
+            else {
+                for (uint32_t i = 0; i < n; ++i) {
+                    condition.notify_one();
+                }
+            }
+        }
+
+#endif
+
+        void EventCount::notify_one() noexcept {
+            notify(1);
+        }
+
+        void EventCount::notify_n(const uint32_t& n) noexcept {
+            notify(n);
+        }
+
+        void EventCount::notify_all() noexcept {
+            notify(UINT32_MAX);
+        }
+
+    }  // namespace scheduler
+}  // namespace threading
+}  // namespace NUClear
@@ -0,0 +1,128 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NUCLEAR_THREADING_SCHEDULER_EVENT_COUNT_HPP
+#define NUCLEAR_THREADING_SCHEDULER_EVENT_COUNT_HPP
+
+#include <atomic>
+#include <cstdint>
+
+#if !defined(__linux__)
+    #include <condition_variable>
+    #include <mutex>
+#endif
+
+namespace NUClear {
+namespace threading {
+    namespace scheduler {
+
+        /**
+         * An eventcount that lets threads sleep until some lock-free condition changes.
+         *
+         * A thread that wants to sleep first calls prepare_wait(), then re-checks its condition, and then either calls
+         * cancel_wait() if it found what it was waiting for, or wait() with the key it was given.
+         * Any notify that happens after prepare_wait() will cause wait() to return immediately, so a change made
+         * between checking the condition and going to sleep is never lost.
+         *
+         * Notifying only touches shared state when a thread is actually between prepare_wait() and waking up, so
+         * notifying while every thread is busy costs a fence and a load.
+         *
+         * On Linux sleeping threads park directly on a futex, on other platforms a mutex and condition variable are
+         * used for the sleep itself.
+         */
+        class EventCount {
+        public:
+            using Key = uint32_t;
+
+            EventCount() = default;
+
+            EventCount(const EventCount&)            = delete;
+            EventCount(EventCount&&)                 = delete;
+            EventCount& operator=(const EventCount&) = delete;
+            EventCount& operator=(EventCount&&)      = delete;
+
+            /**
+             * Announce that this thread is about to wait.
+             *
+             * After calling this the caller must re-check the condition it is waiting on, and then call exactly one of
+             * cancel_wait() or wait().
+             *
+             * @return the key to pass to wait()
+             */
+            Key prepare_wait() noexcept;
+
+            /**
+             * Abandon a wait that was announced with prepare_wait().
+             */
+            void cancel_wait() noexcept;
+
+            /**
+             * Sleep until a notify happens after the prepare_wait() call that returned the given key.
+             *
+             * @param key the key returned by prepare_wait()
+             */
+            void wait(const Key& key) noexcept;
+
+            /**
+             * Wake one waiting thread, if there are any.
+             */
+            void notify_one() noexcept;
+
+            /**
+             * Wake up to n waiting threads, if there are any.
+             *
+             * This is a single notification, so waking several threads costs the same as waking one.
+             *
+             * @param n the most threads to wake
+             */
+            void notify_n(const uint32_t& n) noexcept;
+
+            /**
+             * Wake all waiting threads, if there are any.
+             */
+            void notify_all() noexcept;
+
+        private:
+            /**
+             * Advance the epoch and wake waiting threads if there are any.
+             *
+             * @param n the most threads to wake
+             */
+            void notify(const uint32_t& n) noexcept;
+
+            /// Incremented by every notify that finds a waiting thread, waiting threads sleep until this changes
+            std::atomic<uint32_t> epoch{0};
+            /// The number of threads between prepare_wait() and the end of their wait
+            std::atomic<uint32_t> waiters{0};
+
+#if !defined(__linux__)
+            /// The mutex the condition variable is waited on with
+            std::mutex mutex;
+            /// The condition variable waiting threads sleep on
+            std::condition_variable condition;
+#endif
+        };
+
+    }  // namespace scheduler
+}  // namespace threading
+}  // namespace NUClear
+
+#endif  // NUCLEAR_THREADING_SCHEDULER_EVENT_COUNT_HPP
@@ -24,9 +24,10 @@
 #include <algorithm>
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
-#include <set>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -35,8 +36,10 @@
 #include "../../dsl/word/Pool.hpp"
 #include "../../id.hpp"
 #include "../../threading/Reaction.hpp"
+#include "../../util/GroupDescriptorSet.hpp"
 #include "../../util/Inline.hpp"
 #include "../ReactionTask.hpp"
+#include "../TaskAllocator.hpp"
 #include "CountingLock.hpp"
 #include "Scheduler.hpp"
 #include "queue/MPSCQueue.hpp"
@@ -64,10 +67,15 @@ namespace threading {
                 }
             }
 
-            if (this->descriptor->counts_for_idle) {
-                scheduler.active_pools.fetch_add(1, std::memory_order_relaxed);
-                pool_idle = std::make_unique<CountingLock>(scheduler.active_pools);
-            }
+            // Work stealing only makes sense where there are peers to steal from. The default pool takes its
+            // setting from the scheduler as its descriptor is shared by every PowerPlant.
+            const bool requested = this->descriptor == dsl::word::Pool<>::descriptor()
+                                       ? scheduler.default_pool_work_stealing
+                                       : this->descriptor->work_stealing;
+            work_stealing        = !single_consumer && requested;
+
+            // Pools start out idle, so they are not counted in the scheduler's active pools until they get work
+            pool_idle.store(this->descriptor->counts_for_idle, std::memory_order_relaxed);
         }
 
         Pool::~Pool() {
@@ -85,8 +93,10 @@ namespace threading {
             catch (...) {  // NOLINT(bugprone-empty-catch)
                 // std::thread::join() may throw std::system_error on failure.
             }
-            // One less active pool
-            scheduler.active_pools.fetch_sub(descriptor->counts_for_idle ? 1 : 0, std::memory_order_relaxed);
+            // If we were still counted as an active pool, we aren't any more
+            if (!pool_idle.load(std::memory_order_acquire)) {
+                scheduler.active_pools.fetch_sub(descriptor->counts_for_idle ? 1 : 0, std::memory_order_relaxed);
+            }
         }
 
         void Pool::start() {
@@ -95,74 +105,79 @@ namespace threading {
 
             active = descriptor->counts_for_idle ? n_threads : 0;
 
+            // Every worker must exist before any thread starts, as work stealing threads scan all of their peers
+            /*mutex scope*/ {
+                const std::lock_guard<std::mutex> lock(mutex);
+                for (int i = 0; i < n_threads; ++i) {
+                    workers.emplace_back(std::make_unique<Worker>(workers.size()));
+                }
+            }
+
             if (descriptor == dsl::word::MainThread::descriptor()) {
-                run();
+                run(*workers.front());
             }
             else {
                 const std::lock_guard<std::mutex> lock(mutex);
-                for (int i = 0; i < n_threads; ++i) {
-                    threads.emplace_back(std::make_unique<std::thread>(&Pool::run, this));
+                for (const auto& worker : workers) {
+                    threads.emplace_back(std::make_unique<std::thread>(&Pool::run, this, std::ref(*worker)));
                 }
             }
         }
 
         void Pool::stop(const StopType& type) {
             // Drained tasks may hold group locks whose destructors can re-enter the pool; defer
-            // their destruction until after the mutex is released.
+            // their destruction until this function returns.
             std::vector<Task> drained;
-            {
-                std::unique_lock<std::mutex> lock(mutex);
-
-                live = true;
-                accept.store(descriptor->persistent, std::memory_order_release);
-
-                switch (type) {
-                    case StopType::NORMAL: {
-                        running = descriptor->persistent;
-                    } break;
-                    case StopType::FINAL: {
-                        running = false;
-                    } break;
-                    case StopType::FORCE: {
-                        // A force stop is terminal even for persistent pools: stop accepting new work so
-                        // nothing can repopulate the queues after we drain them and wind the threads down.
-                        accept.store(false, std::memory_order_release);
-                        running = false;
-
-                        // MPSC buckets permit only one consumer. A cross-thread FORCE stop (e.g.
-                        // PowerPlant::shutdown(true) from TestBase's timeout thread against a
-                        // MainThread or concurrency-1 pool) must delegate queue draining to that
-                        // worker instead of calling try_dequeue here.
-                        const bool mpsc_consumer_alive =
-                            single_consumer && consumer_thread_id != std::thread::id{};
-                        const bool on_mpsc_consumer =
-                            mpsc_consumer_alive && std::this_thread::get_id() == consumer_thread_id;
-
-                        if (mpsc_consumer_alive && !on_mpsc_consumer) {
-                            discard_queues_requested.store(true, std::memory_order_release);
-                            condition.notify_all();
-                            condition.wait(lock, [this] {
-                                return !discard_queues_requested.load(std::memory_order_acquire);
-                            });
-                            pending_tasks.store(0, std::memory_order_relaxed);
-                        }
-                        else {
-                            drain_queues(drained);
-                            pending_tasks.store(0, std::memory_order_relaxed);
-                        }
-                    } break;
-                }
-                condition.notify_all();
+
+            accept.store(descriptor->persistent, std::memory_order_release);
+
+            switch (type) {
+                case StopType::NORMAL: {
+                    running.store(descriptor->persistent, std::memory_order_release);
+                } break;
+                case StopType::FINAL: {
+                    running.store(false, std::memory_order_release);
+                } break;
+                case StopType::FORCE: {
+                    // A force stop is terminal even for persistent pools: stop accepting new work so
+                    // nothing can repopulate the queues after we drain them and wind the threads down.
+                    accept.store(false, std::memory_order_release);
+                    running.store(false, std::memory_order_release);
+
+                    // MPSC buckets permit only one consumer. A cross-thread FORCE stop (e.g.
+                    // PowerPlant::shutdown(true) from TestBase's timeout thread against a
+                    // MainThread or concurrency-1 pool) must delegate queue draining to that
+                    // worker instead of calling try_dequeue here.
+                    const bool mpsc_consumer_alive = single_consumer && consumer_thread_id != std::thread::id{};
+                    const bool on_mpsc_consumer =
+                        mpsc_consumer_alive && std::this_thread::get_id() == consumer_thread_id;
+
+                    if (mpsc_consumer_alive && !on_mpsc_consumer) {
+                        discard_queues_requested.store(true, std::memory_order_release);
+                        sleep.notify_all();
+
+                        std::unique_lock<std::mutex> lock(mutex);
+                        condition.wait(lock, [this] {
+                            return !discard_queues_requested.load(std::memory_order_acquire);
+                        });
+                        pending_tasks.store(0, std::memory_order_relaxed);
+                    }
+                    else {
+                        drain_queues(drained);
+                        pending_tasks.store(0, std::memory_order_relaxed);
+                    }
+                } break;
             }
+
+            // Wake every worker so they notice the new state
+            sleep.notify_all();
         }
 
         void Pool::notify(bool clear_idle) {
-            const std::lock_guard<std::mutex> lock(mutex);
-            live = true;
             if (clear_idle) {
-                pool_idle = nullptr;
+                release_pool_idle();
             }
-            condition.notify_one();
+            sleep.notify_one();
         }
 
         void Pool::join() const {
@@ -179,15 +194,55 @@ namespace threading {
             }
 
             const std::size_t bucket = queue::priority_index(task.task->priority);
-            pending_tasks.fetch_add(1, std::memory_order_release);
-            buckets[bucket]->enqueue(std::move(task));
+            const std::size_t queued = pending_tasks.fetch_add(1, std::memory_order_release);
+
+            // When one of our own workers submits a task that needs no lock, it becomes that worker's next task.
+            // The worker picks it up as soon as its current task finishes, but one sleeping peer is still woken so it
+            // can steal the task if the current task keeps running for a long time.
+            // This is only done when nothing else is queued, so the slot never lets a task overtake an older one.
+            if (queued == 0 && current_pool == this && current_worker != nullptr && task.lock == nullptr
+                && current_worker->next.offer(task.task, bucket)) {
+                if (clear_idle) {
+                    release_pool_idle();
+                }
+                sleep.notify_one();
+                return;
+            }
+
+            // Tasks submitted by one of our own workers stay on that worker's local queue so they keep its cache,
+            // unless it is full in which case they spill over to the shared bucket.
+            const bool local = work_stealing && current_pool == this && current_worker != nullptr
+                               && current_worker->local[bucket].push(std::move(task));
+            if (!local) {
+                buckets[bucket]->enqueue(std::move(task));
+            }
 
-            const std::lock_guard<std::mutex> lock(mutex);
             if (clear_idle) {
-                pool_idle = nullptr;
+                release_pool_idle();
             }
-            live = true;
-            condition.notify_one();
+            sleep.notify_one();
+        }
+
+        void Pool::submit(std::vector<Task>&& tasks, bool clear_idle) {
+            if (tasks.empty() || !accept.load(std::memory_order_acquire)) {
+                return;
+            }
+
+            pending_tasks.fetch_add(tasks.size(), std::memory_order_release);
+
+            // A batch is spread across the pool rather than kept on this worker, so the next task slot isn't used
+            const bool own_worker = work_stealing && current_pool == this && current_worker != nullptr;
+            for (auto& task : tasks) {
+                const std::size_t bucket = queue::priority_index(task.task->priority);
+                if (!(own_worker && current_worker->local[bucket].push(std::move(task)))) {
+                    buckets[bucket]->enqueue(std::move(task));
+                }
+            }
+
+            if (clear_idle) {
+                release_pool_idle();
+            }
+            sleep.notify_n(uint32_t(std::min<std::size_t>(tasks.size(), UINT32_MAX)));
         }
 
         ExternalWaiterRegistration::ExternalWaiterRegistration(ExternalWaiterRegistration&& other) noexcept
@@ -232,13 +287,12 @@ namespace threading {
             // the queue (in which case it would otherwise be picked up directly with no idle
             // fire). See Pool::get_task for the consumer.
             //
-            // Only acquire the mutex + notify the worker on the 0->1 transition of the latch.
-            // Subsequent parkings while the latch is already set don't need to wake the worker
-            // again -- the latch already says "fire idle before the next dispatch", and one
-            // wake is enough to bring the worker out of condition.wait.
+            // Only notify the worker on the 0->1 transition of the latch. Subsequent parkings
+            // while the latch is already set don't need to wake the worker again -- the latch
+            // already says "fire idle before the next dispatch", and one wake is enough to bring
+            // the worker out of its sleep.
             if (!pending_idle.exchange(true, std::memory_order_acq_rel)) {
-                const std::lock_guard<std::mutex> lock(mutex);
-                condition.notify_one();
+                sleep.notify_one();
             }
             return ExternalWaiterRegistration{this};
         }
@@ -246,18 +300,21 @@ namespace threading {
         void Pool::unregister_external_waiter() {
             if (external_waiters.fetch_sub(1, std::memory_order_acq_rel) == 1) {
                 // Wake any worker that may be parked specifically because external_waiters was > 0.
-                const std::lock_guard<std::mutex> lock(mutex);
-                condition.notify_all();
+                sleep.notify_all();
             }
         }
 
         void Pool::add_idle_task(const std::shared_ptr<Reaction>& reaction) {
-            const std::lock_guard<std::mutex> lock(mutex);
-            idle_tasks.push_back(reaction);
-            idle_task_count.fetch_add(1, std::memory_order_release);
+            bool first = false;
+            /*mutex scope*/ {
+                const std::lock_guard<std::mutex> lock(mutex);
+                idle_tasks.push_back(reaction);
+                idle_task_count.fetch_add(1, std::memory_order_release);
+                first = idle_tasks.size() == 1;
+            }
 
-            if (idle_tasks.size() == 1) {
-                condition.notify_one();
+            if (first) {
+                sleep.notify_one();
             }
         }
 
@@ -280,13 +337,13 @@ namespace threading {
         }
 
         bool Pool::is_idle() const {
-            const std::lock_guard<std::mutex> lock(mutex);
-            return pool_idle != nullptr;
+            return pool_idle.load(std::memory_order_acquire);
         }
 
-        void Pool::run() {
-            consumer_thread_id = std::this_thread::get_id();
-            Pool::current_pool = this;
+        void Pool::run(Worker& worker) {
+            consumer_thread_id   = std::this_thread::get_id();
+            Pool::current_pool   = this;
+            Pool::current_worker = &worker;
             try {
                 while (true) {
                     Task task = get_task();
@@ -294,15 +351,71 @@ namespace threading {
                 }
             }
             catch (const ShutdownThreadException&) {
-                Pool::current_pool = nullptr;
-                consumer_thread_id = std::thread::id{};
+                Pool::current_pool   = nullptr;
+                Pool::current_worker = nullptr;
+                consumer_thread_id   = std::thread::id{};
                 return;
             }
         }
 
+        bool Pool::try_get_runnable_task(Task& out, bool& blocked) {
+            blocked = false;
+            if (!try_dequeue_task(out)) {
+                return false;
+            }
+            if (out.lock == nullptr || out.lock->lock()) {
+                current_worker->idle = nullptr;
+                release_pool_idle();
+                return true;
+            }
+
+            // The task was dequeued but its lock isn't acquirable. Re-enqueue it and let the
+            // caller wait for someone to notify us when the lock state changes.
+            requeue(std::move(out));
+            out     = Task{};
+            blocked = true;
+            return false;
+        }
+
+        bool Pool::spin_for_work() const {
+            for (int i = 0; i < SPIN_ATTEMPTS; ++i) {
+                if (pending_tasks.load(std::memory_order_acquire) > 0 || pending_idle.load(std::memory_order_acquire)
+                    || discard_queues_requested.load(std::memory_order_acquire) || finished()) {
+                    return true;
+                }
+                std::this_thread::yield();
+            }
+            return false;
+        }
+
+        bool Pool::finished() const {
+            return !running.load(std::memory_order_acquire) && pending_tasks.load(std::memory_order_acquire) == 0
+                   && external_waiters.load(std::memory_order_acquire) == 0
+                   && !discard_queues_requested.load(std::memory_order_acquire);
+        }
+
         bool Pool::try_dequeue_task(Task& out) {
+            // Don't scan every peer when there is nothing to find
+            if (pending_tasks.load(std::memory_order_acquire) == 0) {
+                return false;
+            }
+
+            // Walk the priorities from highest to lowest so neither the next task slots nor stealing ever let a
+            // lower priority task overtake a higher priority one that is sitting in another queue
+            Worker& self        = *current_worker;
+            const std::size_t n = workers.size();
+            std::unique_ptr<ReactionTask> next;
             for (std::size_t i = 0; i < queue::PRIORITY_BUCKETS; ++i) {
-                if (buckets[i]->try_dequeue(out)) {
+                bool got = self.next.take(i, next) || (work_stealing && self.local[i].pop(out))
+                           || buckets[i]->try_dequeue(out);
+                for (std::size_t offset = 1; !got && offset < n; ++offset) {
+                    Worker& peer = *workers[(self.index + offset) % n];
+                    got          = peer.next.take(i, next) || (work_stealing && peer.local[i].steal(out));
+                }
+                if (next != nullptr) {
+                    out = Task{std::move(next)};
+                }
+                if (got) {
                     pending_tasks.fetch_sub(1, std::memory_order_release);
                     return true;
                 }
@@ -310,6 +423,39 @@ namespace threading {
             return false;
         }
 
+        void Pool::requeue(Task&& task) {
+            const std::size_t bucket = queue::priority_index(task.task->priority);
+            pending_tasks.fetch_add(1, std::memory_order_release);
+            buckets[bucket]->enqueue(std::move(task));
+        }
+
+        bool Pool::acquire_pool_idle() {
+            // Whoever flips the flag owns the transition, so the active pool count is only ever adjusted once
+            if (pool_idle.exchange(true, std::memory_order_acq_rel)) {
+                return false;
+            }
+            return scheduler.active_pools.fetch_sub(1, std::memory_order_acq_rel) == 1;
+        }
+
+        void Pool::release_pool_idle() {
+            // Check with a load first so busy submitters don't all fight over the cache line
+            if (pool_idle.load(std::memory_order_acquire) && pool_idle.exchange(false, std::memory_order_acq_rel)) {
+                scheduler.active_pools.fetch_add(1, std::memory_order_release);
+            }
+        }
+
+        void Pool::discard_queues() {
+            std::vector<Task> discarded;
+            drain_queues(discarded);
+            pending_tasks.store(0, std::memory_order_relaxed);
+
+            /*mutex scope*/ {
+                const std::lock_guard<std::mutex> lock(mutex);
+                discard_queues_requested.store(false, std::memory_order_release);
+            }
+            condition.notify_all();
+        }
+
         void Pool::drain_queues(std::vector<Task>& out) const {
             Task task;
             for (const auto& bucket : buckets) {
@@ -317,22 +463,23 @@ namespace threading {
                     out.push_back(std::move(task));
                 }
             }
+            for (const auto& worker : workers) {
+                std::unique_ptr<ReactionTask> next;
+                if (worker->next.take_any(next)) {
+                    out.emplace_back(std::move(next));
+                }
+                for (auto& local : worker->local) {
+                    while (local.steal(task)) {
+                        out.push_back(std::move(task));
+                    }
+                }
+            }
         }
 
         Pool::Task Pool::get_task() {
-            std::unique_lock<std::mutex> lock(mutex);
-            while (running || pending_tasks.load(std::memory_order_acquire) > 0
-                   || external_waiters.load(std::memory_order_acquire) > 0
-                   || discard_queues_requested.load(std::memory_order_acquire)) {
+            while (!finished()) {
                 if (discard_queues_requested.load(std::memory_order_acquire)) {
-                    std::vector<Task> discarded;
-                    drain_queues(discarded);
-                    pending_tasks.store(0, std::memory_order_relaxed);
-                    discard_queues_requested.store(false, std::memory_order_release);
-                    condition.notify_all();
-                    lock.unlock();
-                    discarded.clear();
-                    lock.lock();
+                    discard_queues();
                     continue;
                 }
 
@@ -376,15 +523,15 @@ namespace threading {
                 // monitor on ARM). So gating the write behind a load is the only way to keep this
                 // hot per-dispatch check free of cross-core cache-line ping-pong on a busy pool.
                 //
-                // A plain store (rather than exchange) is safe here even though we don't hold the
-                // mutex: we never branch on the old value, so there is nothing for exchange to give
+                // A plain store (rather than exchange) is safe here even though another thread may
+                // be setting it: we never branch on the old value, so there is nothing for exchange to give
                 // us that store doesn't. The apparent "lost wakeup" if a new waiter's
                 // register_external_waiter() sees the latch already true (skips its notify) and we
                 // then clear it here is not actually a correctness issue, because neither
                 // notify_one() call is what makes a parked waiter's task eventually run: submit()
                 // (when the drained task is enqueued) and unregister_external_waiter() (when
-                // external_waiters returns to 0) both notify unconditionally, under the pool's
-                // mutex, on every transition that the wait predicate below actually depends on.
+                // external_waiters returns to 0) both notify unconditionally on every transition
+                // that the re-check before sleeping below actually depends on.
                 // pending_idle's own notify is purely a latency optimization to promptly wake a
                 // worker that is sleeping for no other reason than "nothing has happened yet"; if
                 // it is occasionally skipped, the worker is woken anyway by one of those other
@@ -398,52 +545,55 @@ namespace threading {
                     }
                 }
 
-                bool got = false;
-                if (live) {
-                    Task task;
-                    got = try_dequeue_task(task);
-                    if (got) {
-                        if (task.lock == nullptr || task.lock->lock()) {
-                            thread_idle[std::this_thread::get_id()] = nullptr;
-                            pool_idle                               = nullptr;
-                            return task;
-                        }
-                        // The task was dequeued but its lock isn't acquirable. Re-enqueue and
-                        // wait for someone to notify us when the lock state changes.
-                        const std::size_t bucket = queue::priority_index(task.task->priority);
-                        pending_tasks.fetch_add(1, std::memory_order_release);
-                        buckets[bucket]->enqueue(std::move(task));
-                    }
+                Task task;
+                bool blocked = false;
+                if (try_get_runnable_task(task, blocked)) {
+                    return task;
                 }
-                live = false;
 
                 // Only account for idle when we genuinely found nothing; threads whose locks
                 // fail are not idle, they are blocked waiting for the lock state to change.
-                if (!got) {
+                if (!blocked) {
                     auto idle_task = get_idle_task();
                     if (idle_task.task != nullptr) {
                         return idle_task;
                     }
+
+                    // New work often turns up within a few microseconds, which is far cheaper to wait for than a sleep
+                    if (spin_for_work()) {
+                        continue;
+                    }
                 }
 
-                condition.wait(lock, [this] {
-                    return live || pending_idle.load(std::memory_order_acquire)
-                           || discard_queues_requested.load(std::memory_order_acquire)
-                           || (!running && pending_tasks.load(std::memory_order_acquire) == 0
-                               && external_waiters.load(std::memory_order_acquire) == 0);
-                });
+                // Announce that we are about to sleep, then check everything that could have changed before a
+                // submitter could see us. Anything that changes after this point will wake us from the sleep.
+                const auto key = sleep.prepare_wait();
+                if (pending_idle.load(std::memory_order_acquire)
+                    || discard_queues_requested.load(std::memory_order_acquire) || finished()) {
+                    sleep.cancel_wait();
+                    continue;
+                }
+                if (try_get_runnable_task(task, blocked)) {
+                    sleep.cancel_wait();
+                    return task;
+                }
+                // The blocks we freed for other threads would be stuck in our batch until we woke up
+                TaskAllocator::flush_remote();
+                sleep.wait(key);
             }
 
-            condition.notify_all();
+            // Make sure the other workers notice that it's time to exit too
+            sleep.notify_all();
             throw ShutdownThreadException();
         }
 
         void Pool::collect_local_idle_reactions(std::vector<std::shared_ptr<Reaction>>& tasks) {
-            auto& local_lock = thread_idle[std::this_thread::get_id()];
+            auto& local_lock = current_worker->idle;
 
             if (local_lock == nullptr) {
                 local_lock = std::make_unique<CountingLock>(active);
                 if (local_lock->lock()) {
+                    const std::lock_guard<std::mutex> lock(mutex);
                     tasks.insert(tasks.end(), idle_tasks.begin(), idle_tasks.end());
                 }
             }
@@ -460,7 +610,7 @@ namespace threading {
                 [](const ReactionTask&) { return 0; },
                 [](const ReactionTask&) { return util::Inline::ALWAYS; },
                 [](const ReactionTask&) { return dsl::word::Pool<>::descriptor(); },
-                [](const ReactionTask&) { return std::set<std::shared_ptr<const util::GroupDescriptor>>{}; });
+                [](const ReactionTask&) { return util::GroupDescriptorSet{}; });
             task->callback = [this, t = std::move(tasks)](const ReactionTask& /*task*/) {
                 for (const auto& idle_task : t) {
                     scheduler.submit(idle_task->get_task());
@@ -471,7 +621,7 @@ namespace threading {
         }
 
         Pool::Task Pool::get_local_idle_task() {
-            if (!running || !descriptor->counts_for_idle) {
+            if (!running.load(std::memory_order_acquire) || !descriptor->counts_for_idle) {
                 return Task{};
             }
 
@@ -481,20 +631,17 @@ namespace threading {
         }
 
         Pool::Task Pool::get_idle_task() {
-            if (!running || !descriptor->counts_for_idle) {
+            if (!running.load(std::memory_order_acquire) || !descriptor->counts_for_idle) {
                 return Task{};
             }
 
             std::vector<std::shared_ptr<Reaction>> tasks;
             collect_local_idle_reactions(tasks);
 
-            if (pool_idle == nullptr && active.load(std::memory_order_relaxed) == 0) {
-                pool_idle = std::make_unique<CountingLock>(scheduler.active_pools);
-
-                if (pool_idle->lock()) {
-                    const std::lock_guard<std::mutex> lock(scheduler.idle_mutex);
-                    tasks.insert(tasks.end(), scheduler.idle_tasks.begin(), scheduler.idle_tasks.end());
-                }
+            if (!pool_idle.load(std::memory_order_acquire) && active.load(std::memory_order_relaxed) == 0
+                && acquire_pool_idle()) {
+                const std::lock_guard<std::mutex> lock(scheduler.idle_mutex);
+                tasks.insert(tasks.end(), scheduler.idle_tasks.begin(), scheduler.idle_tasks.end());
             }
 
             return make_idle_dispatch_task(std::move(tasks));
@@ -502,6 +649,8 @@ namespace threading {
 
         // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
         thread_local Pool* Pool::current_pool = nullptr;
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+        thread_local Pool::Worker* Pool::current_worker = nullptr;
 
     }  // namespace scheduler
 }  // namespace threading
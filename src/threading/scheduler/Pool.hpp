@@ -25,7 +25,7 @@
 #include <array>
 #include <atomic>
 #include <condition_variable>
-#include <map>
+#include <cstddef>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -33,11 +33,14 @@
 
 #include "../../util/ThreadPoolDescriptor.hpp"
 #include "../ReactionTask.hpp"
+#include "EventCount.hpp"
 #include "Lock.hpp"
+#include "queue/LifoSlot.hpp"
 #include "queue/MPSCQueue.hpp"
 #include "queue/Priority.hpp"
 #include "queue/Queue.hpp"
 #include "queue/TaskQueue.hpp"
+#include "queue/WorkStealingQueue.hpp"
 
 namespace NUClear {
 namespace threading {
@@ -160,6 +163,17 @@ namespace threading {
              */
             void submit(Task&& task, bool clear_idle, bool force = false);
 
+            /**
+             * Submit several tasks to this thread pool at once.
+             *
+             * The tasks are queued in order, then a single notification wakes as many sleeping workers as there are
+             * tasks, rather than waking them one at a time.
+             *
+             * @param tasks      The tasks to submit
+             * @param clear_idle If true, the idle state of the pool will be cleared
+             */
+            void submit(std::vector<Task>&& tasks, bool clear_idle);
+
             /**
              * Register that a task is in flight outside the pool but will eventually be submitted to it.
              *
@@ -210,13 +224,33 @@ namespace threading {
              */
             class ShutdownThreadException : public std::exception {};
 
+            /**
+             * The state owned by a single thread of this pool.
+             */
+            struct Worker {
+                explicit Worker(const std::size_t& index) : index(index) {}
+
+                /// The position of this worker in the pool's worker list
+                const std::size_t index;
+                /// The first lock free task this worker submitted to its own pool since it last looked here.
+                /// It runs as soon as the worker's current task finishes, unless an idle peer steals it first.
+                queue::LifoSlot<ReactionTask> next;
+                /// This worker's own queue for each priority bucket, only used when the pool is work stealing.
+                /// Tasks submitted from this worker land here and are taken by it first, or stolen by idle peers.
+                std::array<queue::WorkStealingQueue<Task>, queue::PRIORITY_BUCKETS> local;
+                /// The lock which holds the idle state for this worker
+                std::unique_ptr<Lock> idle;
+            };
+
             /**
              * The main function executed by each thread in the pool.
              *
              * The thread will wait for a task to be available and then execute it.
              * This will continue until the pool is stopped.
+             *
+             * @param worker the state owned by this thread
              */
-            void run();
+            void run(Worker& worker);
 
             /**
              * Get the next task to execute.
@@ -227,15 +261,70 @@ namespace threading {
              */
             Task get_task();
 
+            /**
+             * Try to dequeue a task and acquire its lock, clearing this worker's and the pool's idle state on success.
+             *
+             * If a task is dequeued but its lock can't be acquired yet it is put back in the queue and blocked is set,
+             * the worker should then wait for the lock state to change rather than treat itself as idle.
+             *
+             * @param out     the task to fill if one is available
+             * @param blocked set to true if the dequeued task could not be locked
+             *
+             * @return true if a runnable task was dequeued and its lock acquired
+             */
+            bool try_get_runnable_task(Task& out, bool& blocked);
+
+            /**
+             * Poll briefly for new work before a worker commits to sleeping.
+             *
+             * @return true if something arrived that the worker should look at
+             */
+            bool spin_for_work() const;
+
+            /**
+             * Check if this pool has shut down and has nothing left that could give its workers work.
+             *
+             * @return true if the workers should exit
+             */
+            bool finished() const;
+
             /**
              * Try to dequeue a runnable task from the priority buckets.
              *
+             * Each bucket is checked in this worker's next task slot, its local queue if the pool is work stealing,
+             * then the shared queue, and then the slots and local queues of the other workers, before moving on to
+             * the next lower priority.
+             *
              * @param out the task to fill if one is available
              *
              * @return true if a task was dequeued
              */
             bool try_dequeue_task(Task& out);
 
+            /**
+             * Put a dequeued task whose lock could not be acquired back into the shared priority buckets.
+             *
+             * @param task the task to requeue
+             */
+            void requeue(Task&& task);
+
+            /**
+             * Mark this pool as idle, taking it out of the scheduler's count of active pools.
+             *
+             * @return true if this pool was the last active pool, in which case global idle should fire
+             */
+            bool acquire_pool_idle();
+
+            /**
+             * Clear this pool's idle state if it is set, returning it to the scheduler's count of active pools.
+             */
+            void release_pool_idle();
+
+            /**
+             * Discard every queued task on behalf of a FORCE stop from another thread and tell it we are done.
+             */
+            void discard_queues();
+
             /**
              * Drain all tasks from the priority buckets into out.
              *
@@ -301,7 +390,7 @@ namespace threading {
             Scheduler& scheduler;
 
             /// If running is false this means the pool is shutting down and no more tasks will be accepted
-            bool running = true;
+            std::atomic<bool> running{true};
             /// If accept is false this pool will no longer accept new tasks.
             /// Atomic so that producers on the fast path can check it without taking the pool mutex.
             std::atomic<bool> accept{true};
@@ -346,18 +435,24 @@ namespace threading {
              * idle, which keeps the hot Sync-contended submission path free of extra synchronisation.
              */
             bool idle_relevant() const;
-            /// A boolean which is set to true when the queue is modified and set to false when there was no work to do
-            bool live = true;
             /// True when this pool's buckets use MPSCQueue (single consumer).
             bool single_consumer = false;
+            /// True when this pool's workers keep their own local queues and steal from each other.
+            bool work_stealing = false;
             /// Worker thread that owns MPSC dequeue; default until run() sets it.
             std::thread::id consumer_thread_id;
             /// Set by a non-consumer FORCE stop to request the worker discard queued tasks.
             std::atomic<bool> discard_queues_requested{false};
 
-            /// The mutex which protects idle tasks and the live flag
+            /// Workers that can't find anything to do sleep on this until a submit, notify or stop wakes them.
+            /// Submitters only touch it when a worker is actually sleeping, so the busy path never takes a lock.
+            EventCount sleep;
+            /// How many times a worker polls for new work before going to sleep
+            static constexpr int SPIN_ATTEMPTS = 64;
+
+            /// The mutex which protects the idle task list and the discard handshake
             mutable std::mutex mutex;
-            /// The condition variable which threads wait on if they can't get a task
+            /// The condition variable a FORCE stop waits on for the consumer to finish discarding its queues
             std::condition_variable condition;
 
             /// The number of active threads in this pool
@@ -365,16 +460,18 @@ namespace threading {
             /// The idle tasks for this pool
             std::vector<std::shared_ptr<Reaction>> idle_tasks;
 
-            /// The lock which holds the idle state for the specific thread in the pool
-            std::map<std::thread::id, std::unique_ptr<Lock>> thread_idle;
+            /// The per-thread state of each worker, populated before any of the threads start
+            std::vector<std::unique_ptr<Worker>> workers;
 
-            /// When this lock is held, the pool is considered idle
+            /// When this is set the pool is considered idle and has taken itself out of the scheduler's active pools
             /// The idle status will be removed when a non idle task is retrieved from the queue
             /// Or when another thread pool notifies this pool, giving its chance at global idle to this pool
-            std::unique_ptr<Lock> pool_idle = nullptr;
+            std::atomic<bool> pool_idle{false};
 
             /// A thread local pointer to the current pool this thread is running in
             static thread_local Pool* current_pool;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+            /// A thread local pointer to the worker state of the current thread in current_pool
+            static thread_local Worker* current_worker;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
             friend class Scheduler;
         };
@@ -23,9 +23,9 @@
 
 #include <algorithm>
 #include <atomic>
+#include <iterator>
 #include <memory>
 #include <mutex>
-#include <set>
 #include <stdexcept>
 #include <utility>
 #include <vector>
@@ -43,7 +43,9 @@ namespace NUClear {
 namespace threading {
     namespace scheduler {
 
-        Scheduler::Scheduler(const int& default_pool_concurrency) : default_pool_concurrency(default_pool_concurrency) {
+        Scheduler::Scheduler(const int& default_pool_concurrency, const bool& default_pool_work_stealing)
+            : default_pool_concurrency(default_pool_concurrency)
+            , default_pool_work_stealing(default_pool_work_stealing) {
             // Create the main thread pool and assign it as our "current pool" so things we do pre startup are assigned
             Pool::current_pool = get_pool(dsl::word::MainThread::descriptor()).get();
         }
@@ -188,11 +190,29 @@ namespace threading {
             return groups.at(desc);
         }
 
+        Group* Scheduler::get_group(Reaction* reaction,
+                                    const std::size_t& index,
+                                    const std::shared_ptr<const util::GroupDescriptor>& desc) {
+            if (reaction == nullptr || index >= Reaction::GROUP_CACHE_SIZE) {
+                return get_group(desc).get();
+            }
+
+            // Same benign race as the pool cache, every thread that misses resolves the same group for a descriptor
+            auto& cache  = reaction->group_data[index];
+            Group* group = cache.load(std::memory_order_acquire);
+            if (group == nullptr || group->descriptor != desc) {
+                group = get_group(desc).get();
+                cache.store(group, std::memory_order_release);
+            }
+            return group;
+        }
+
         std::unique_ptr<Lock> Scheduler::get_groups_lock(
             const NUClear::id_t& task_id,
             const int& priority,
             Pool* pool,
-            const std::set<std::shared_ptr<const util::GroupDescriptor>>& descs) {
+            Reaction* reaction,
+            const util::GroupDescriptorSet& descs) {
 
             // No groups
             if (descs.empty()) {
@@ -200,9 +220,10 @@ namespace threading {
             }
 
             // Make a lock which waits for all the groups to be unlocked
-            auto lock = std::make_unique<CombinedLock>();
+            auto lock         = std::make_unique<CombinedLock>();
+            std::size_t index = 0;
             for (const auto& desc : descs) {
-                lock->add(get_group(desc)->lock(task_id, priority, [pool] {
+                lock->add(get_group(reaction, index++, desc)->lock(task_id, priority, [pool] {
                     const auto current_pool = Pool::current();
                     const bool current_pool_idle = current_pool != nullptr && current_pool->is_idle();
                     pool->notify(!current_pool_idle);
@@ -212,14 +233,7 @@ namespace threading {
             return lock;
         }
 
-        void Scheduler::submit(std::unique_ptr<ReactionTask>&& task) noexcept {
-            // Ignore null tasks
-            if (task == nullptr) {
-                return;
-            }
-
-            // Resolve the Pool for this task.
-            //
+        Pool* Scheduler::resolve_pool(const ReactionTask& task) {
             // The first submit for a reaction does a mutex-protected `get_pool()` lookup; the
             // resulting pointer is then cached on the parent Reaction so subsequent submits skip
             // the mutex entirely.
@@ -235,23 +249,34 @@ namespace threading {
             // both call `get_pool()` and store the same pointer; last writer wins, identical
             // value.
             Pool* pool = nullptr;
-            if (task->parent) {
-                pool = task->parent->scheduler_data.load(std::memory_order_acquire);
+            if (task.parent) {
+                pool = task.parent->scheduler_data.load(std::memory_order_acquire);
                 if (pool == nullptr) {
-                    pool = get_pool(task->pool_descriptor).get();
-                    task->parent->scheduler_data.store(pool, std::memory_order_release);
+                    pool = get_pool(task.pool_descriptor).get();
+                    task.parent->scheduler_data.store(pool, std::memory_order_release);
                 }
             }
             else {
-                pool = get_pool(task->pool_descriptor).get();
+                pool = get_pool(task.pool_descriptor).get();
             }
+            return pool;
+        }
 
-            const auto current_pool = Pool::current();
+        void Scheduler::submit(std::unique_ptr<ReactionTask>&& task) noexcept {
+            // Ignore null tasks
+            if (task == nullptr) {
+                return;
+            }
+
+            Pool* pool = resolve_pool(*task);
+
+            // Read the thread local directly rather than Pool::current() so submit doesn't touch the pool's refcount
+            const Pool* current_pool     = Pool::current_pool;
             const bool current_pool_idle = current_pool != nullptr && current_pool->is_idle();
 
             // Fast path for a single group: lock-free token acquisition and waiter buckets
             if (task->group_descriptors.size() == 1) {
-                const auto& group = get_group(*task->group_descriptors.begin());
+                Group* group = get_group(task->parent.get(), 0, *task->group_descriptors.begin());
 
                 if (task->run_inline) {
                     if (auto running_lock = group->try_acquire_running_lock()) {
@@ -265,7 +290,8 @@ namespace threading {
             }
 
             // Slow path for multiple groups: mutex-backed combined locks
-            auto group_lock = get_groups_lock(task->id, task->priority, pool, task->group_descriptors);
+            auto group_lock =
+                get_groups_lock(task->id, task->priority, pool, task->parent.get(), task->group_descriptors);
 
             if (task->run_inline && (group_lock == nullptr || group_lock->lock())) {
                 task->run();
@@ -275,6 +301,46 @@ namespace threading {
             }
         }
 
+        void Scheduler::submit(std::vector<std::unique_ptr<ReactionTask>>&& tasks) noexcept {
+            const Pool* current_pool = Pool::current_pool;
+            const bool clear_idle    = current_pool == nullptr || !current_pool->is_idle();
+
+            // The tasks for each pool, in the order the pools were first seen
+            std::vector<std::pair<Pool*, std::vector<Pool::Task>>> batches;
+            const auto flush = [&] {
+                for (auto& batch : batches) {
+                    batch.first->submit(std::move(batch.second), clear_idle);
+                }
+                batches.clear();
+            };
+
+            for (auto& task : tasks) {
+                if (task == nullptr) {
+                    continue;
+                }
+
+                // Tasks that need group locks or may run inline take the normal path.
+                // Anything batched before them is submitted first so tasks are still queued in order.
+                if (!task->group_descriptors.empty() || task->run_inline) {
+                    flush();
+                    submit(std::move(task));
+                    continue;
+                }
+
+                Pool* pool = resolve_pool(*task);
+                auto it    = std::find_if(batches.begin(), batches.end(), [pool](const auto& b) {
+                    return b.first == pool;
+                });
+                if (it == batches.end()) {
+                    batches.emplace_back(pool, std::vector<Pool::Task>());
+                    batches.back().second.reserve(tasks.size());
+                    it = std::prev(batches.end());
+                }
+                it->second.emplace_back(std::move(task));
+            }
+            flush();
+        }
+
     }  // namespace scheduler
 }  // namespace threading
 }  // namespace NUClear
@@ -46,7 +46,7 @@ namespace threading {
 
         class Scheduler {
         public:
-            explicit Scheduler(const int& default_pool_concurrency);
+            explicit Scheduler(const int& default_pool_concurrency, const bool& default_pool_work_stealing = false);
 
             /**
              * Clears the per-thread "current pool" pointer this Scheduler installed in its constructor.
@@ -91,6 +91,17 @@ namespace threading {
              */
             void submit(std::unique_ptr<ReactionTask>&& task) noexcept;
 
+            /**
+             * Submit several tasks to the Scheduler at once.
+             *
+             * Tasks that don't need group locks and won't run inline are grouped by the pool they run on, and each
+             * pool receives its tasks as one batch with a single wake up for all of them.
+             * Other tasks are submitted as if by submit, and tasks for the same pool are always queued in order.
+             *
+             * @param tasks the reaction tasks to submit, null tasks are ignored
+             */
+            void submit(std::vector<std::unique_ptr<ReactionTask>>&& tasks) noexcept;
+
             /**
              * Adds a task to the idle task list.
              *
@@ -124,6 +135,15 @@ namespace threading {
              */
             std::shared_ptr<Pool> get_pool(const std::shared_ptr<const util::ThreadPoolDescriptor>& desc);
 
+            /**
+             * Gets the pool a task will run on, using the cache on the task's reaction if it has one.
+             *
+             * @param task the task to find the pool for
+             *
+             * @return a non-owning pointer to the pool, which lives as long as the scheduler
+             */
+            Pool* resolve_pool(const ReactionTask& task);
+
             /**
              * Gets a pointer to a specific group, or creates a new one if it does not exist.
              *
@@ -133,12 +153,26 @@ namespace threading {
              */
             std::shared_ptr<Group> get_group(const std::shared_ptr<const util::GroupDescriptor>& desc);
 
+            /**
+             * Gets the group for a descriptor, using the cache on the reaction if it has one.
+             *
+             * @param reaction the reaction whose cache should be used, or nullptr to always look the group up
+             * @param index    the position of the descriptor in the task's group descriptors
+             * @param desc     the descriptor for the group to get
+             *
+             * @return a non-owning pointer to the group, which lives as long as the scheduler
+             */
+            Group* get_group(Reaction* reaction,
+                             const std::size_t& index,
+                             const std::shared_ptr<const util::GroupDescriptor>& desc);
+
             /**
              * Gets a lock object for all the groups listed in the descriptors.
              *
              * @param task_id   the id of the task that is requesting the lock for sorting purposes
              * @param priority  the priority of the task that is requesting the lock for sorting purposes
              * @param pool      the pool to notify when the lock is acquired
+             * @param reaction  the reaction that the task belongs to, used to cache the groups it locks
              * @param descs     the descriptors for the groups to lock on
              *
              * @return a combined lock representing the state of all the groups
@@ -146,10 +180,13 @@ namespace threading {
             std::unique_ptr<Lock> get_groups_lock(const NUClear::id_t& task_id,
                                                   const int& priority,
                                                   Pool* pool,
-                                                  const std::set<std::shared_ptr<const util::GroupDescriptor>>& descs);
+                                                  Reaction* reaction,
+                                                  const util::GroupDescriptorSet& descs);
 
             /// The number of threads that will be in the default thread pool
             const int default_pool_concurrency;
+            /// If the default thread pool runs in work stealing mode
+            const bool default_pool_work_stealing;
 
             /// If running is false this means the scheduler is shutting down and no new pools will be created
             std::atomic<bool> running{true};
@@ -0,0 +1,138 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NUCLEAR_THREADING_SCHEDULER_QUEUE_LIFO_SLOT_HPP
+#define NUCLEAR_THREADING_SCHEDULER_QUEUE_LIFO_SLOT_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace NUClear {
+namespace threading {
+    namespace scheduler {
+        namespace queue {
+
+            /**
+             * A single slot holding the next task a pool worker should run.
+             *
+             * The owning worker fills the slot when it submits a task to its own pool, and takes it back as soon as
+             * its current task finishes, so the task runs on the same cache warm thread that created it. Other
+             * workers may steal it out of the slot if they run out of work first.
+             *
+             * The priority bucket of the task is packed into the low bits of the pointer. This lets a taker check
+             * that the slot holds a task of the bucket it is looking at without dereferencing it, as a thief could
+             * otherwise read a task that another thread has already taken and destroyed.
+             *
+             * @tparam T the type of task held in the slot
+             */
+            template <typename T>
+            class LifoSlot {
+                static constexpr std::uintptr_t TAG_MASK = 0x7;
+                static_assert(alignof(T) > TAG_MASK, "The task type must leave room for the bucket in its pointer");
+
+            public:
+                LifoSlot() = default;
+
+                LifoSlot(const LifoSlot&)            = delete;
+                LifoSlot& operator=(const LifoSlot&) = delete;
+                LifoSlot(LifoSlot&&)                 = delete;
+                LifoSlot& operator=(LifoSlot&&)      = delete;
+
+                ~LifoSlot() {
+                    std::unique_ptr<T> discard;
+                    take_any(discard);
+                }
+
+                /**
+                 * Put a task in the slot if it is empty.
+                 *
+                 * Must only be called from the owning thread.
+                 *
+                 * @param task   the task to place, it is only moved from if this returns true
+                 * @param bucket the priority bucket of the task
+                 *
+                 * @return true if the slot was empty and now holds the task
+                 */
+                bool offer(std::unique_ptr<T>& task, const std::size_t& bucket) {
+                    // Only the owner ever fills the slot, so if it is empty here nobody else can fill it before we do
+                    if (slot.load(std::memory_order_relaxed) != 0) {
+                        return false;
+                    }
+                    slot.store(reinterpret_cast<std::uintptr_t>(task.release()) | bucket,  // NOLINT
+                               std::memory_order_release);
+                    return true;
+                }
+
+                /**
+                 * Take the task out of the slot if it holds one of the given priority bucket.
+                 *
+                 * Safe to call from any thread.
+                 *
+                 * @param bucket the priority bucket to take from
+                 * @param out    the task taken out of the slot
+                 *
+                 * @return true if a task was taken
+                 */
+                bool take(const std::size_t& bucket, std::unique_ptr<T>& out) {
+                    std::uintptr_t value = slot.load(std::memory_order_acquire);
+                    if (value == 0 || (value & TAG_MASK) != bucket) {
+                        return false;
+                    }
+                    return claim(value, out);
+                }
+
+                /**
+                 * Take whatever task is in the slot regardless of its priority bucket.
+                 *
+                 * Safe to call from any thread.
+                 *
+                 * @param out the task taken out of the slot
+                 *
+                 * @return true if a task was taken
+                 */
+                bool take_any(std::unique_ptr<T>& out) {
+                    std::uintptr_t value = slot.load(std::memory_order_acquire);
+                    return value != 0 && claim(value, out);
+                }
+
+            private:
+                bool claim(std::uintptr_t value, std::unique_ptr<T>& out) {
+                    // If the value has changed someone else got there first. Even if the same task address has since
+                    // been reused and offered again, it carries the same bucket, so taking it is still correct.
+                    if (!slot.compare_exchange_strong(value, 0, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                        return false;
+                    }
+                    out.reset(reinterpret_cast<T*>(value & ~TAG_MASK));  // NOLINT
+                    return true;
+                }
+
+                /// The owned task pointer with its priority bucket in the low bits, or 0 when empty
+                std::atomic<std::uintptr_t> slot{0};
+            };
+
+        }  // namespace queue
+    }  // namespace scheduler
+}  // namespace threading
+}  // namespace NUClear
+
+#endif  // NUCLEAR_THREADING_SCHEDULER_QUEUE_LIFO_SLOT_HPP
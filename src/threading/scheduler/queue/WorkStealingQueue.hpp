@@ -0,0 +1,181 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NUCLEAR_THREADING_SCHEDULER_QUEUE_WORK_STEALING_QUEUE_HPP
+#define NUCLEAR_THREADING_SCHEDULER_QUEUE_WORK_STEALING_QUEUE_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace NUClear {
+namespace threading {
+    namespace scheduler {
+        namespace queue {
+
+            /**
+             * Bounded single-producer multi-consumer FIFO ring owned by one pool worker.
+             *
+             * Only the owning worker may push(). Both the owner (pop) and any other thread (steal) take from the
+             * head with a CAS, so the owner and its thieves agree on exactly one winner for every slot. When the ring
+             * is full push() fails and the caller spills to the pool's shared buckets, which keeps this structure
+             * allocation free.
+             *
+             * Elements are stored as a pair of raw owning pointers held in per-slot atomics rather than as a T,
+             * because a thief reads a slot before it knows whether its CAS will win. Should the CAS lose, the slot
+             * may meanwhile have been reused by the owner; reading it through relaxed atomics makes that discarded
+             * read well defined. A slot can only be reused once head has moved past it and head never moves
+             * backwards, so a winning CAS guarantees the pointers read belong to that slot's current element.
+             *
+             * @tparam T        a pair of owning pointers exposed as the `task` and `lock` members (e.g. Pool::Task),
+             *                  constructible from those two pointers
+             * @tparam Capacity the number of slots in the ring, must be a power of two
+             */
+            template <typename T, std::size_t Capacity = 256>
+            class WorkStealingQueue {
+                static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+                using TaskPtr = decltype(std::declval<T&>().task);
+                using LockPtr = decltype(std::declval<T&>().lock);
+
+            public:
+                WorkStealingQueue() = default;
+
+                WorkStealingQueue(const WorkStealingQueue&)            = delete;
+                WorkStealingQueue& operator=(const WorkStealingQueue&) = delete;
+                WorkStealingQueue(WorkStealingQueue&&)                 = delete;
+                WorkStealingQueue& operator=(WorkStealingQueue&&)      = delete;
+
+                ~WorkStealingQueue() {
+                    // Reclaim anything still queued; only ever reached once no other thread can touch the ring.
+                    T discard;
+                    while (steal(discard)) {
+                        discard = T{};
+                    }
+                }
+
+                /**
+                 * Push an item onto the tail of the ring.
+                 *
+                 * Must only be called from the owning thread.
+                 *
+                 * @param item the value to move into the ring, left untouched if the ring is full
+                 *
+                 * @return true if the item was queued, false if the ring is full
+                 */
+                bool push(T&& item) {
+                    const std::uint64_t t = tail.load(std::memory_order_relaxed);
+                    const std::uint64_t h = head.load(std::memory_order_acquire);
+                    if (t - h >= Capacity) {
+                        return false;
+                    }
+
+                    Slot& slot = slots[t & (Capacity - 1)];
+                    slot.task.store(item.task.release(), std::memory_order_relaxed);
+                    slot.lock.store(item.lock.release(), std::memory_order_relaxed);
+                    tail.store(t + 1, std::memory_order_release);
+                    return true;
+                }
+
+                /**
+                 * Take the oldest item from the ring.
+                 *
+                 * Must only be called from the owning thread.
+                 *
+                 * @param out receives the dequeued value when this returns true
+                 *
+                 * @return true if `out` was populated; false if the ring was empty
+                 */
+                bool pop(T& out) {
+                    return take(out);
+                }
+
+                /**
+                 * Take the oldest item from the ring on behalf of another worker.
+                 *
+                 * Safe to call from any thread concurrently with the owner's push/pop and with other thieves.
+                 *
+                 * @param out receives the dequeued value when this returns true
+                 *
+                 * @return true if `out` was populated; false if the ring was empty
+                 */
+                bool steal(T& out) {
+                    return take(out);
+                }
+
+                /**
+                 * Returns whether the ring currently holds no items.
+                 *
+                 * The answer is only a snapshot when other threads are pushing or taking concurrently.
+                 *
+                 * @return true if there is nothing to take
+                 */
+                bool empty() const {
+                    return tail.load(std::memory_order_acquire) == head.load(std::memory_order_acquire);
+                }
+
+            private:
+                struct Slot {
+                    std::atomic<typename TaskPtr::pointer> task{nullptr};
+                    std::atomic<typename LockPtr::pointer> lock{nullptr};
+                };
+
+                bool take(T& out) {
+                    std::uint64_t h = head.load(std::memory_order_acquire);
+                    while (true) {
+                        const std::uint64_t t = tail.load(std::memory_order_acquire);
+                        if (h == t) {
+                            return false;
+                        }
+
+                        Slot& slot = slots[h & (Capacity - 1)];
+                        auto* task = slot.task.load(std::memory_order_relaxed);
+                        auto* lock = slot.lock.load(std::memory_order_relaxed);
+                        if (head.compare_exchange_weak(h,
+                                                       h + 1,
+                                                       std::memory_order_acq_rel,
+                                                       std::memory_order_acquire)) {
+                            out = T(TaskPtr(task), LockPtr(lock));
+                            return true;
+                        }
+                    }
+                }
+
+                /// Cache line size assumed when separating the thief-contended head from the owner's tail.
+                static constexpr std::size_t CACHE_LINE = 64;
+
+                std::array<Slot, Capacity> slots{};
+                /// Next slot to take, advanced by CAS from the owner and from thieves.
+                std::atomic<std::uint64_t> head{0};
+                /// Keeps head and tail on separate cache lines so thieves polling head don't bounce the owner's tail.
+                std::array<char, CACHE_LINE - sizeof(std::atomic<std::uint64_t>)> padding{};
+                /// Next slot to fill, written only by the owner.
+                std::atomic<std::uint64_t> tail{0};
+            };
+
+        }  // namespace queue
+    }  // namespace scheduler
+}  // namespace threading
+}  // namespace NUClear
+
+#endif  // NUCLEAR_THREADING_SCHEDULER_QUEUE_WORK_STEALING_QUEUE_HPP
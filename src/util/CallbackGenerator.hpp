@@ -27,6 +27,7 @@
 
 #include "../dsl/word/emit/Inline.hpp"
 #include "../message/ReactionStatistics.hpp"
+#include "../threading/TaskAllocator.hpp"
 #include "../util/MergeTransient.hpp"
 #include "../util/TransientDataElements.hpp"
 #include "../util/apply.hpp"
@@ -120,8 +121,8 @@ namespace util {
             }
 
             // We have to make a copy of the callback because the "this" variable can go out of scope
-            auto c         = callback;
-            task->callback = [c, data](threading::ReactionTask& task) noexcept {
+            auto c   = callback;
+            auto run = [c, data](threading::ReactionTask& task) noexcept {
                 // Update our thread's priority to the correct level
                 update_current_thread_priority(task.priority);
 
@@ -152,6 +153,12 @@ namespace util {
                 }
             };
 
+            // Keep track of reactions whose bound data is too big to be stored inside the task
+            if (!threading::ReactionTask::TaskFunction::stores_inline<decltype(run)>()) {
+                threading::TaskAllocator::count_spilled_callback();
+            }
+            task->callback = std::move(run);
+
             return task;
         }
 
@@ -0,0 +1,259 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "Epoch.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <limits>
+
+namespace NUClear {
+namespace util {
+
+    namespace {
+
+        /// The epoch value of a thread that is not reading
+        constexpr uint64_t INACTIVE = std::numeric_limits<uint64_t>::max();
+        /// Cache line size assumed when keeping each thread's announced epoch away from other threads' data
+        constexpr std::size_t CACHE_LINE = 64;
+
+        /// An object waiting for the readers that might still see it to finish
+        struct Retired {
+            /// The global epoch at the time the object was retired
+            uint64_t epoch;
+            const void* ptr;
+            void (*deleter)(const void*);
+        };
+
+    }  // namespace
+
+    struct Epoch::Record {
+        /// Keeps the announced epoch off the cache line of whatever was allocated before this record
+        std::array<char, CACHE_LINE> padding_front{};
+        /// The epoch this thread was in when its outermost guard was taken, or INACTIVE if it holds no guard
+        std::atomic<uint64_t> epoch{INACTIVE};
+        /// Keeps the owner-only fields below off the line that other threads read when reclaiming
+        std::array<char, CACHE_LINE - sizeof(std::atomic<uint64_t>)> padding_back{};
+
+        /// How many guards this thread holds, only touched by the owning thread
+        int depth{0};
+        /// Set when reclaim left objects behind, they are checked again when the outermost guard is released
+        bool deferred{false};
+        /// Set while scan is running the deleters, a scan they start is put off until the guard is next released
+        bool scanning{false};
+        /// The objects this thread has retired that have not been deleted yet, oldest first, only touched by the owner
+        std::deque<Retired> retired;
+        /// The size the retired list has to reach before it is checked again, only touched by the owning thread
+        std::size_t scan_at{Epoch::RECLAIM_THRESHOLD};
+        /// The size of the retired list, readable from any thread
+        std::atomic<std::size_t> retired_count{0};
+
+        /// If a thread currently owns this record
+        std::atomic<bool> in_use{true};
+        /// The next record in the registry, set once before the record is published
+        Record* next{nullptr};
+    };
+
+    namespace {
+
+        /// The global epoch along with every record that has ever been created
+        struct Registry {
+            /// The global epoch, advanced every time a thread checks its retired objects
+            std::atomic<uint64_t> epoch{0};
+            /// The records form a list that is only ever added to, so it can be walked without a lock
+            std::atomic<Epoch::Record*> head{nullptr};
+        };
+
+        Registry& registry() {
+            // Guards can be released during static destruction, so the registry is never destroyed
+            static Registry* instance = new Registry();  // NOLINT(cppcoreguidelines-owning-memory)
+            return *instance;
+        }
+
+        Epoch::Record* acquire_record() {
+            auto& r = registry();
+
+            // Adopt a record that a thread gave back when it exited, along with anything it left retired
+            Epoch::Record* head = r.head.load(std::memory_order_acquire);
+            for (Epoch::Record* record = head; record != nullptr; record = record->next) {
+                bool expected = false;
+                if (!record->in_use.load(std::memory_order_relaxed)
+                    && record->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                    return record;
+                }
+            }
+
+            auto* record = new Epoch::Record();  // NOLINT(cppcoreguidelines-owning-memory)
+            do {
+                record->next = head;
+            } while (!r.head.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+            return record;
+        }
+
+        /**
+         * Delete every object in the record's retired list that no reader can still see.
+         *
+         * @param record the record of the current thread
+         */
+        void scan(Epoch::Record& record) {
+            // A deleter can release the last reference to something that retires or reclaims in its destructor.
+            // Scanning again from in there would pop the items the outer scan is still working through.
+            if (record.scanning) {
+                record.deferred = true;
+                return;
+            }
+
+            auto& r = registry();
+
+            // Readers that start after this announce a newer epoch than anything already in our list
+            r.epoch.fetch_add(1, std::memory_order_seq_cst);
+
+            // Anything retired before the oldest epoch a reader announced can no longer be seen by anyone
+            uint64_t oldest = INACTIVE;
+            for (Epoch::Record* other = r.head.load(std::memory_order_acquire); other != nullptr; other = other->next) {
+                oldest = std::min(oldest, other->epoch.load(std::memory_order_seq_cst));
+            }
+
+            // Objects are retired in epoch order, so the ones that are ready are always at the front of the list
+            std::size_t ready = 0;
+            while (ready < record.retired.size() && record.retired[ready].epoch < oldest) {
+                ++ready;
+            }
+            const std::size_t remaining = record.retired.size() - ready;
+
+            // Wait for the list to double before checking it again so the objects a reader is holding back aren't
+            // checked on every retire
+            record.scan_at = remaining < Epoch::RECLAIM_THRESHOLD / 2 ? Epoch::RECLAIM_THRESHOLD : remaining * 2;
+
+            // The deleters may retire more objects, these go on the back of the list so they are not touched here
+            record.scanning = true;
+            for (std::size_t i = 0; i < ready; ++i) {
+                const Retired item = record.retired.front();
+                record.retired.pop_front();
+                record.retired_count.store(record.retired.size(), std::memory_order_relaxed);
+                item.deleter(item.ptr);
+            }
+            record.scanning = false;
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+        thread_local Epoch::Record* current_record = nullptr;
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+        thread_local bool thread_exited = false;
+
+        /// Gives the thread's record back to the registry when the thread exits so a future thread can reuse it
+        struct ThreadRecord {
+            ThreadRecord()                               = default;
+            ThreadRecord(const ThreadRecord&)            = delete;
+            ThreadRecord(ThreadRecord&&)                 = delete;
+            ThreadRecord& operator=(const ThreadRecord&) = delete;
+            ThreadRecord& operator=(ThreadRecord&&)      = delete;
+            ~ThreadRecord() {
+                // A guard still held while the thread exits keeps its record, it is just never reused
+                if (current_record != nullptr && current_record->depth == 0) {
+                    scan(*current_record);
+                    current_record->deferred = false;
+                    current_record->in_use.store(false, std::memory_order_release);
+                }
+                current_record = nullptr;
+                thread_exited  = true;
+            }
+
+            /// Set once this thread has a record, this also makes sure the destructor is registered
+            bool registered{false};
+        };
+
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+        thread_local ThreadRecord thread_record;
+
+        /**
+         * Get the record for the current thread, creating or adopting one if needed.
+         *
+         * A thread that reads after its thread locals have been destroyed gets a record that is never reused.
+         *
+         * @return the record for this thread
+         */
+        Epoch::Record* local_record() {
+            if (current_record == nullptr) {
+                current_record = acquire_record();
+                if (!thread_exited) {
+                    thread_record.registered = true;
+                }
+            }
+            return current_record;
+        }
+
+    }  // namespace
+
+    Epoch::Guard::Guard() noexcept : record(local_record()) {
+        if (record->depth++ == 0) {
+            // The announcement must be visible before we load any pointer we are protecting.
+            // A writer that unpublished that pointer either sees this announcement or retired it in a later epoch.
+            record->epoch.store(registry().epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+        }
+    }
+
+    Epoch::Guard::Guard(Guard&& other) noexcept : record(other.record) {
+        other.record = nullptr;
+    }
+
+    Epoch::Guard::~Guard() {
+        if (record != nullptr && --record->depth == 0) {
+            record->epoch.store(INACTIVE, std::memory_order_release);
+
+            // A reclaim that ran while we were reading may have been waiting for us
+            if (record->deferred) {
+                record->deferred = false;
+                scan(*record);
+            }
+        }
+    }
+
+    void Epoch::retire(const void* ptr, void (*deleter)(const void*)) {
+        Record* record = local_record();
+        record->retired.push_back(Retired{registry().epoch.load(std::memory_order_seq_cst), ptr, deleter});
+        record->retired_count.store(record->retired.size(), std::memory_order_relaxed);
+
+        if (record->retired.size() >= record->scan_at) {
+            scan(*record);
+        }
+    }
+
+    void Epoch::reclaim() {
+        Record* record = local_record();
+        scan(*record);
+        record->deferred = !record->retired.empty();
+    }
+
+    std::size_t Epoch::pending() {
+        std::size_t total = 0;
+        Record* head      = registry().head.load(std::memory_order_acquire);
+        for (Record* record = head; record != nullptr; record = record->next) {
+            total += record->retired_count.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+}  // namespace util
+}  // namespace NUClear
@@ -0,0 +1,106 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NUCLEAR_UTIL_EPOCH_HPP
+#define NUCLEAR_UTIL_EPOCH_HPP
+
+#include <cstddef>
+
+namespace NUClear {
+namespace util {
+
+    /**
+     * Epoch based reclamation for data that is read without locks.
+     *
+     * Readers hold a Guard while they use a pointer they loaded from shared state.
+     * Writers publish a replacement, and then retire the old object rather than deleting it.
+     * A retired object is only deleted once every thread that was reading when it was retired has released its guard,
+     * so a reader never sees memory that has been freed underneath it.
+     *
+     * Taking a guard is wait-free and only writes to memory owned by the current thread.
+     * Guards can be nested, only the outermost guard on a thread does any work.
+     *
+     * Retired objects are kept in a list owned by the retiring thread, so retiring doesn't take any locks either.
+     * Once a thread has retired enough objects it checks which of them can no longer be seen and deletes those.
+     */
+    class Epoch {
+    public:
+        /// The number of objects a thread retires before it tries to delete them, this grows with the objects a
+        /// reader is still holding back so that a long running reader doesn't make every retire check the whole list
+        static constexpr std::size_t RECLAIM_THRESHOLD = 16;
+
+        /// The per-thread state that records which epoch a thread is reading in
+        struct Record;
+
+        /**
+         * Marks the current thread as reading until this object is destroyed.
+         *
+         * Any object that is retired while the guard is held stays alive until after the guard is released.
+         */
+        class Guard {
+        public:
+            Guard() noexcept;
+            ~Guard();
+
+            Guard(const Guard&)            = delete;
+            Guard& operator=(const Guard&) = delete;
+            Guard(Guard&& other) noexcept;
+            Guard& operator=(Guard&&) = delete;
+
+        private:
+            /// The record this guard announced its epoch in, or nullptr if it has been moved from
+            Record* record;
+        };
+
+        /**
+         * Deletes an object once no thread can still be reading it.
+         *
+         * The object must already be unreachable for new readers, so it has to be unpublished before it is retired.
+         * The deleter runs later on this thread, once this thread has retired enough objects to check them or when
+         * reclaim is called.
+         * A deleter may itself retire objects, reclaim or take guards, anything that needs checking from in there is
+         * left until the next time this thread releases its outermost guard.
+         *
+         * @param ptr     the object to delete
+         * @param deleter the function that deletes the object
+         */
+        static void retire(const void* ptr, void (*deleter)(const void*));
+
+        /**
+         * Deletes every object this thread has retired that can no longer be seen by a reader.
+         *
+         * Objects that are still visible are checked again when this thread next releases its outermost guard.
+         * This is for writers that want their old objects released promptly rather than when the thread next writes.
+         */
+        static void reclaim();
+
+        /**
+         * Gets the number of objects that have been retired but not yet deleted.
+         *
+         * @return the number of objects waiting to be deleted
+         */
+        static std::size_t pending();
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_EPOCH_HPP
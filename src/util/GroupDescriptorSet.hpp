@@ -0,0 +1,176 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NUCLEAR_UTIL_GROUP_DESCRIPTOR_SET_HPP
+#define NUCLEAR_UTIL_GROUP_DESCRIPTOR_SET_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "GroupDescriptor.hpp"
+
+namespace NUClear {
+namespace util {
+
+    /**
+     * A sorted set of group descriptors that stores a small number of groups inside itself.
+     *
+     * Almost every reaction is in no groups or a single group, so this replaces a std::set which needed a heap
+     * allocation for every element of every task.
+     * Up to INLINE_CAPACITY descriptors are stored inline, a set with more than that moves them all to the heap.
+     *
+     * Descriptors are kept in the same order a std::set would keep them in, so code that locks groups in iteration
+     * order locks them in a consistent order.
+     */
+    class GroupDescriptorSet {
+    public:
+        using value_type     = std::shared_ptr<const GroupDescriptor>;
+        using const_iterator = const value_type*;
+        using iterator       = const_iterator;
+
+        /// The number of descriptors that can be held without allocating
+        static constexpr std::size_t INLINE_CAPACITY = 4;
+
+        GroupDescriptorSet() = default;
+
+        GroupDescriptorSet(std::initializer_list<value_type> descriptors) {
+            insert(descriptors.begin(), descriptors.end());
+        }
+
+        /**
+         * Build a set from any range of descriptors, such as the std::set that group words used to return.
+         *
+         * @param range the descriptors to add
+         */
+        template <typename Range,
+                  typename = std::enable_if_t<!std::is_same<std::decay_t<Range>, GroupDescriptorSet>::value>,
+                  typename = decltype(std::begin(std::declval<const Range&>()))>
+        GroupDescriptorSet(const Range& range) {  // NOLINT(google-explicit-constructor)
+            insert(std::begin(range), std::end(range));
+        }
+
+        GroupDescriptorSet(const GroupDescriptorSet&)            = default;
+        GroupDescriptorSet& operator=(const GroupDescriptorSet&) = default;
+
+        GroupDescriptorSet(GroupDescriptorSet&& other) noexcept
+            : local(std::move(other.local)), spilled(std::move(other.spilled)), count(std::exchange(other.count, 0)) {}
+
+        GroupDescriptorSet& operator=(GroupDescriptorSet&& other) noexcept {
+            if (this != &other) {
+                local   = std::move(other.local);
+                spilled = std::move(other.spilled);
+                count   = std::exchange(other.count, 0);
+                other.spilled.clear();
+            }
+            return *this;
+        }
+
+        ~GroupDescriptorSet() = default;
+
+        /**
+         * Add a descriptor to the set if it isn't already in it.
+         *
+         * @param descriptor the descriptor to add
+         */
+        void insert(const value_type& descriptor) {
+            const auto position = std::lower_bound(begin(), end(), descriptor, std::less<value_type>());
+            if (position != end() && *position == descriptor) {
+                return;
+            }
+            const auto offset = std::distance(cbegin(), position);
+
+            if (spilled.empty() && count < INLINE_CAPACITY) {
+                std::move_backward(local.begin() + offset, local.begin() + count, local.begin() + count + 1);
+                local[offset] = descriptor;
+                ++count;
+            }
+            else {
+                if (spilled.empty()) {
+                    spilled.reserve(count + 1);
+                    std::move(local.begin(), local.begin() + count, std::back_inserter(spilled));
+                    std::fill(local.begin(), local.end(), nullptr);
+                }
+                spilled.insert(spilled.begin() + offset, descriptor);
+                count = spilled.size();
+            }
+        }
+
+        /**
+         * Add a range of descriptors to the set.
+         *
+         * @param first the start of the range
+         * @param last  the end of the range
+         */
+        template <typename It>
+        void insert(It first, It last) {
+            for (; first != last; ++first) {
+                insert(*first);
+            }
+        }
+
+        const_iterator begin() const {
+            return spilled.empty() ? local.data() : spilled.data();
+        }
+        const_iterator end() const {
+            return begin() + count;
+        }
+        const_iterator cbegin() const {
+            return begin();
+        }
+        const_iterator cend() const {
+            return end();
+        }
+
+        std::size_t size() const {
+            return count;
+        }
+        bool empty() const {
+            return count == 0;
+        }
+
+        friend bool operator==(const GroupDescriptorSet& lhs, const GroupDescriptorSet& rhs) {
+            return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+        friend bool operator!=(const GroupDescriptorSet& lhs, const GroupDescriptorSet& rhs) {
+            return !(lhs == rhs);
+        }
+
+    private:
+        /// The descriptors when there are few enough of them to be stored inline
+        std::array<value_type, INLINE_CAPACITY> local{};
+        /// All of the descriptors once there are too many to store inline
+        std::vector<value_type> spilled;
+        /// The number of descriptors in the set
+        std::size_t count{0};
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_GROUP_DESCRIPTOR_SET_HPP
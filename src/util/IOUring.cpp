@@ -0,0 +1,335 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "IOUring.hpp"
+
+#if defined(__linux__) && defined(NUCLEAR_IO_URING)
+
+    #include <linux/io_uring.h>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+
+    #include <algorithm>
+    #include <cstring>
+    #include <vector>
+
+namespace NUClear {
+namespace util {
+
+    namespace {
+
+        /// The buffer group that the ring's buffers are registered as
+        constexpr uint16_t BUFFER_GROUP = 0;
+
+        int io_uring_setup(unsigned entries, io_uring_params* params) {
+            return int(::syscall(__NR_io_uring_setup, entries, params));
+        }
+
+        int io_uring_enter(int fd, unsigned to_submit) {
+            return int(::syscall(__NR_io_uring_enter, fd, to_submit, 0, 0, nullptr, 0));
+        }
+
+        int io_uring_register(int fd, unsigned opcode, void* arg, unsigned nr_args) {
+            return int(::syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+        }
+
+        template <typename T>
+        T* offset(void* base, const uint32_t& bytes) {
+            return reinterpret_cast<T*>(static_cast<char*>(base) + bytes);  // NOLINT
+        }
+
+        void* map(const int& fd, const std::size_t& size, const off_t& off) {
+            void* ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, off);
+            return ptr == MAP_FAILED ? nullptr : ptr;
+        }
+
+    }  // namespace
+
+    IOUring::IOUring(unsigned entries, uint16_t buffer_count, uint32_t buffer_size)
+        : buffer_count(buffer_count), buffer_size(buffer_size) {
+
+        io_uring_params params{};
+        params.flags = IORING_SETUP_CLAMP;
+        ring         = FileDescriptor(io_uring_setup(entries, &params));
+        if (!ring.valid()) {
+            return;
+        }
+
+        // Map the submission and completion rings, newer kernels let them share a single mapping
+        sq_map_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_map_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0) {
+            sq_map_size = cq_map_size = std::max(sq_map_size, cq_map_size);
+        }
+        sq_map = map(ring.get(), sq_map_size, IORING_OFF_SQ_RING);
+        cq_map = (params.features & IORING_FEAT_SINGLE_MMAP) != 0 ? nullptr
+                                                                   : map(ring.get(), cq_map_size, IORING_OFF_CQ_RING);
+        sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+        sqes      = map(ring.get(), sqes_size, IORING_OFF_SQES);
+        void* cq  = cq_map != nullptr ? cq_map : sq_map;
+        if (sq_map == nullptr || cq == nullptr || sqes == nullptr) {
+            return;
+        }
+
+        sq_head    = offset<unsigned>(sq_map, params.sq_off.head);
+        sq_tail    = offset<unsigned>(sq_map, params.sq_off.tail);
+        sq_mask    = *offset<unsigned>(sq_map, params.sq_off.ring_mask);
+        sq_entries = params.sq_entries;
+        sq_array   = offset<unsigned>(sq_map, params.sq_off.array);
+        cq_head    = offset<unsigned>(cq, params.cq_off.head);
+        cq_tail    = offset<unsigned>(cq, params.cq_off.tail);
+        cq_mask    = *offset<unsigned>(cq, params.cq_off.ring_mask);
+        cqes       = offset<void>(cq, params.cq_off.cqes);
+
+        // Make sure the kernel knows the operations we are going to use
+        std::vector<char> probe_memory(sizeof(io_uring_probe) + 256 * sizeof(io_uring_probe_op));
+        auto* probe = reinterpret_cast<io_uring_probe*>(probe_memory.data());  // NOLINT
+        if (io_uring_register(ring.get(), IORING_REGISTER_PROBE, probe, 256) < 0) {
+            return;
+        }
+        for (const auto& op : {IORING_OP_READ, IORING_OP_RECV, IORING_OP_ASYNC_CANCEL}) {
+            if (op > probe->last_op || (probe->ops[op].flags & IO_URING_OP_SUPPORTED) == 0) {  // NOLINT
+                return;
+            }
+        }
+
+        // Register the ring of buffers that reads pick from, this fails on kernels without provided buffer rings
+        buffer_ring_size = buffer_count * sizeof(io_uring_buf);
+        buffer_ring      = ::mmap(nullptr,
+                                  buffer_ring_size,
+                                  PROT_READ | PROT_WRITE,
+                                  MAP_ANONYMOUS | MAP_PRIVATE,
+                                  -1,
+                                  0);
+        if (buffer_ring == MAP_FAILED) {
+            buffer_ring = nullptr;
+            return;
+        }
+        io_uring_buf_reg reg{};
+        reg.ring_addr    = reinterpret_cast<uint64_t>(buffer_ring);  // NOLINT
+        reg.ring_entries = buffer_count;
+        reg.bgid         = BUFFER_GROUP;
+        if (io_uring_register(ring.get(), IORING_REGISTER_PBUF_RING, &reg, 1) < 0) {
+            return;
+        }
+
+        buffers.resize(std::size_t(buffer_count) * buffer_size);
+        for (uint16_t id = 0; id < buffer_count; ++id) {
+            recycle(id);
+        }
+
+        supported = true;
+    }
+
+    IOUring::~IOUring() {
+        // Close the ring before unmapping the memory the kernel may still be writing to
+        ring.close();
+        if (buffer_ring != nullptr) {
+            ::munmap(buffer_ring, buffer_ring_size);
+        }
+        if (sqes != nullptr) {
+            ::munmap(sqes, sqes_size);
+        }
+        if (cq_map != nullptr) {
+            ::munmap(cq_map, cq_map_size);
+        }
+        if (sq_map != nullptr) {
+            ::munmap(sq_map, sq_map_size);
+        }
+    }
+
+    bool IOUring::valid() const {
+        return supported;
+    }
+
+    fd_t IOUring::fd() {
+        return ring.get();
+    }
+
+    void* IOUring::next_entry() {
+        unsigned tail = *sq_tail;
+        if (tail - __atomic_load_n(sq_head, __ATOMIC_ACQUIRE) >= sq_entries) {
+            // Give the kernel what we have so far to make some room
+            submit();
+            if (tail - __atomic_load_n(sq_head, __ATOMIC_ACQUIRE) >= sq_entries) {
+                return nullptr;
+            }
+        }
+
+        const unsigned index = tail & sq_mask;
+        auto* sqe            = static_cast<io_uring_sqe*>(sqes) + index;
+        std::memset(sqe, 0, sizeof(io_uring_sqe));
+        sq_array[index] = index;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        __atomic_store_n(sq_tail, tail + 1, __ATOMIC_RELEASE);
+        ++unsubmitted;
+        return sqe;
+    }
+
+    bool IOUring::read(const fd_t& fd, const uint64_t& user_data, const bool& socket, const bool& multishot) {
+        auto* sqe = static_cast<io_uring_sqe*>(next_entry());
+        if (sqe == nullptr) {
+            return false;
+        }
+
+        sqe->opcode    = socket ? IORING_OP_RECV : IORING_OP_READ;
+        sqe->fd        = fd;
+        sqe->flags     = IOSQE_BUFFER_SELECT;
+        sqe->buf_group = BUFFER_GROUP;
+        sqe->user_data = user_data;
+        if (socket) {
+            sqe->ioprio = multishot ? IORING_RECV_MULTISHOT : 0;
+        }
+        else {
+            // Read from the current position so streams and files both work
+            sqe->off = uint64_t(-1);
+        }
+        return true;
+    }
+
+    bool IOUring::cancel(const uint64_t& user_data) {
+        auto* sqe = static_cast<io_uring_sqe*>(next_entry());
+        if (sqe == nullptr) {
+            return false;
+        }
+
+        sqe->opcode    = IORING_OP_ASYNC_CANCEL;
+        sqe->fd        = -1;
+        sqe->addr      = user_data;
+        sqe->user_data = 0;
+        return true;
+    }
+
+    void IOUring::submit() {
+        while (unsubmitted > 0) {
+            const int submitted = io_uring_enter(ring.get(), unsubmitted);
+            if (submitted < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                // The kernel is out of resources, the entries stay queued and will go with the next submit
+                return;
+            }
+            unsubmitted -= std::min(unsubmitted, unsigned(submitted));
+        }
+    }
+
+    void IOUring::reap(std::vector<Completion>& output) {
+        unsigned head       = *cq_head;
+        const unsigned tail = __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE);
+        for (; head != tail; ++head) {
+            const auto& cqe = static_cast<io_uring_cqe*>(cqes)[head & cq_mask];  // NOLINT
+            output.push_back(Completion{cqe.user_data, cqe.res, cqe.flags});
+        }
+        __atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+    }
+
+    const char* IOUring::buffer(const uint16_t& id) const {
+        return buffers.data() + std::size_t(id) * buffer_size;
+    }
+
+    void IOUring::recycle(const uint16_t& id) {
+        // io_uring_buf_ring can't be used directly as its flexible array member is misplaced when compiled as C++
+        // The ring is an array of io_uring_buf with the tail overlaid on the reserved field of the first one
+        auto* slots = static_cast<io_uring_buf*>(buffer_ring);
+        auto& slot  = slots[buffer_tail & (buffer_count - 1)];  // NOLINT
+        slot.addr   = reinterpret_cast<uint64_t>(buffer(id));   // NOLINT
+        slot.len    = buffer_size;
+        slot.bid    = id;
+        ++buffer_tail;
+        __atomic_store_n(&slots->resv, buffer_tail, __ATOMIC_RELEASE);
+    }
+
+    bool IOUring::has_buffer(const uint32_t& flags) {
+        return (flags & IORING_CQE_F_BUFFER) != 0;
+    }
+
+    uint16_t IOUring::buffer_id(const uint32_t& flags) {
+        return uint16_t(flags >> IORING_CQE_BUFFER_SHIFT);
+    }
+
+    bool IOUring::more(const uint32_t& flags) {
+        return (flags & IORING_CQE_F_MORE) != 0;
+    }
+
+}  // namespace util
+}  // namespace NUClear
+
+#else
+
+namespace NUClear {
+namespace util {
+
+    IOUring::IOUring(unsigned /*entries*/, uint16_t /*buffer_count*/, uint32_t /*buffer_size*/) {}
+
+    IOUring::~IOUring() = default;
+
+    bool IOUring::valid() const {
+        return false;
+    }
+
+    fd_t IOUring::fd() {
+        return ring.get();
+    }
+
+    void* IOUring::next_entry() {
+        return nullptr;
+    }
+
+    bool IOUring::read(const fd_t& /*fd*/,
+                       const uint64_t& /*user_data*/,
+                       const bool& /*socket*/,
+                       const bool& /*multishot*/) {
+        return false;
+    }
+
+    bool IOUring::cancel(const uint64_t& /*user_data*/) {
+        return false;
+    }
+
+    void IOUring::submit() {}
+
+    void IOUring::reap(std::vector<Completion>& /*output*/) {}
+
+    const char* IOUring::buffer(const uint16_t& /*id*/) const {
+        return nullptr;
+    }
+
+    void IOUring::recycle(const uint16_t& /*id*/) {}
+
+    bool IOUring::has_buffer(const uint32_t& /*flags*/) {
+        return false;
+    }
+
+    uint16_t IOUring::buffer_id(const uint32_t& /*flags*/) {
+        return 0;
+    }
+
+    bool IOUring::more(const uint32_t& /*flags*/) {
+        return false;
+    }
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif
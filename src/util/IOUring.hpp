@@ -0,0 +1,230 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_IO_URING_HPP
+#define NUCLEAR_UTIL_IO_URING_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "FileDescriptor.hpp"
+
+namespace NUClear {
+namespace util {
+
+    /**
+     * A minimal io_uring instance that reads file descriptors into a ring of buffers it provides to the kernel.
+     *
+     * Reads are queued with buffer selection, so the kernel picks a free buffer from the ring when data arrives rather
+     * than one being tied up by every outstanding read.
+     * Sockets are read with a multishot receive which keeps producing completions until it is cancelled or runs out of
+     * buffers, anything else is read with a single shot read that has to be queued again after each completion.
+     * A buffer belongs to whoever received its completion until it is handed back with `recycle`.
+     *
+     * This talks to the kernel through the raw system calls so it has no dependency on liburing.
+     * If NUClear was built without io_uring support, or the running kernel lacks any of the features that are needed,
+     * `valid()` returns false and the caller is expected to fall back to readiness based IO.
+     *
+     * None of the functions are thread safe, the caller must serialise access to the ring.
+     */
+    class IOUring {
+    public:
+        /**
+         * A single completion that was reaped from the ring.
+         */
+        struct Completion {
+            /// The value that was passed to `read` when the request was queued
+            uint64_t user_data;
+            /// The number of bytes that were read, or a negated errno value on failure
+            int32_t result;
+            /// The completion flags, decode them with `has_buffer`, `buffer_id` and `more`
+            uint32_t flags;
+        };
+
+        /**
+         * Creates a ring and registers its buffers with the kernel.
+         *
+         * @param entries      the number of requests that can be queued at once
+         * @param buffer_count the number of buffers to provide to the kernel, must be a power of two
+         * @param buffer_size  the size in bytes of each buffer
+         */
+        IOUring(unsigned entries, uint16_t buffer_count, uint32_t buffer_size);
+        ~IOUring();
+
+        IOUring(const IOUring&)            = delete;
+        IOUring& operator=(const IOUring&) = delete;
+        IOUring(IOUring&&)                 = delete;
+        IOUring& operator=(IOUring&&)      = delete;
+
+        /**
+         * Returns if the ring was created and the kernel supports everything it needs.
+         *
+         * @return `true` if the ring can be used
+         */
+        bool valid() const;
+
+        /**
+         * The file descriptor of the ring, it becomes readable when there are completions to reap.
+         *
+         * @return the file descriptor of the ring
+         */
+        // NOLINTNEXTLINE(readability-make-member-function-const) gives access to the ring which can change state
+        fd_t fd();
+
+        /**
+         * Queues a read from a file descriptor into one of the ring's buffers.
+         *
+         * @param fd        the file descriptor to read from
+         * @param user_data a value to identify the completions of this request
+         * @param socket    if the file descriptor is a socket, sockets are read with a receive rather than a read
+         * @param multishot if the receive should continue to produce completions, only used for sockets
+         *
+         * @return `true` if the request was queued, `false` if the submission queue is full
+         */
+        bool read(const fd_t& fd, const uint64_t& user_data, const bool& socket, const bool& multishot);
+
+        /**
+         * Queues the cancellation of a previously queued request.
+         *
+         * The completion of the cancel request itself has a user_data of 0.
+         *
+         * @param user_data the value that the request was queued with
+         *
+         * @return `true` if the cancellation was queued, `false` if the submission queue is full
+         */
+        bool cancel(const uint64_t& user_data);
+
+        /**
+         * Tells the kernel about everything that has been queued since the last submit.
+         */
+        void submit();
+
+        /**
+         * Moves every completion that is waiting in the ring to the end of the output list.
+         *
+         * @param output the list to add the completions to
+         */
+        void reap(std::vector<Completion>& output);
+
+        /**
+         * Gets the memory of one of the ring's buffers.
+         *
+         * @param id the id of the buffer from `buffer_id`
+         *
+         * @return a pointer to the start of the buffer
+         */
+        const char* buffer(const uint16_t& id) const;
+
+        /**
+         * Hands a buffer back to the kernel so it can be filled again.
+         *
+         * @param id the id of the buffer from `buffer_id`
+         */
+        void recycle(const uint16_t& id);
+
+        /**
+         * @param flags the flags from a completion
+         *
+         * @return `true` if the completion filled one of the ring's buffers
+         */
+        static bool has_buffer(const uint32_t& flags);
+
+        /**
+         * @param flags the flags from a completion
+         *
+         * @return the id of the buffer that the completion filled
+         */
+        static uint16_t buffer_id(const uint32_t& flags);
+
+        /**
+         * @param flags the flags from a completion
+         *
+         * @return `true` if the request will produce more completions without being queued again
+         */
+        static bool more(const uint32_t& flags);
+
+    private:
+        /**
+         * Gets the next free submission queue entry.
+         *
+         * @return a pointer to the zeroed entry, or nullptr if the submission queue is full
+         */
+        void* next_entry();
+
+        /// The io_uring file descriptor
+        FileDescriptor ring;
+        /// If the kernel supports everything that is needed
+        bool supported{false};
+
+        /// The mapped submission queue ring, it is also the completion queue ring when the kernel maps them together
+        void* sq_map{nullptr};
+        /// The size of the mapped submission queue ring
+        std::size_t sq_map_size{0};
+        /// The mapped completion queue ring if it is separate from the submission queue ring
+        void* cq_map{nullptr};
+        /// The size of the mapped completion queue ring
+        std::size_t cq_map_size{0};
+        /// The mapped submission queue entries
+        void* sqes{nullptr};
+        /// The size of the mapped submission queue entries
+        std::size_t sqes_size{0};
+
+        /// The kernel's head of the submission queue
+        unsigned* sq_head{nullptr};
+        /// Our tail of the submission queue
+        unsigned* sq_tail{nullptr};
+        /// The mask to apply to an index into the submission queue
+        unsigned sq_mask{0};
+        /// The number of entries in the submission queue
+        unsigned sq_entries{0};
+        /// The indirection array from the submission queue to the entries
+        unsigned* sq_array{nullptr};
+        /// Our head of the completion queue
+        unsigned* cq_head{nullptr};
+        /// The kernel's tail of the completion queue
+        unsigned* cq_tail{nullptr};
+        /// The mask to apply to an index into the completion queue
+        unsigned cq_mask{0};
+        /// The completion queue entries
+        void* cqes{nullptr};
+        /// The number of entries that have been queued but not yet submitted
+        unsigned unsubmitted{0};
+
+        /// The ring of buffer descriptors that is shared with the kernel
+        void* buffer_ring{nullptr};
+        /// The size of the mapped buffer ring
+        std::size_t buffer_ring_size{0};
+        /// Our tail of the buffer ring
+        uint16_t buffer_tail{0};
+        /// The number of buffers in the buffer ring
+        uint16_t buffer_count{0};
+        /// The size of each buffer
+        uint32_t buffer_size{0};
+        /// The memory for all of the buffers
+        std::vector<char> buffers;
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_IO_URING_HPP
@@ -0,0 +1,234 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NUCLEAR_UTIL_INLINE_FUNCTION_HPP
+#define NUCLEAR_UTIL_INLINE_FUNCTION_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace NUClear {
+namespace util {
+
+    template <typename Signature, std::size_t Capacity, typename Allocator = std::allocator<char>>
+    class InlineFunction;
+
+    /**
+     * A move only, type erased callable that stores small callables inside itself.
+     *
+     * This fills the same role as std::function, but a callable that fits in Capacity bytes is stored directly in the
+     * object rather than on the heap.
+     * Callables that are too big, too strictly aligned, or that might throw when moved are allocated using Allocator,
+     * which must be default constructible and stateless.
+     *
+     * @tparam R         the return type of the callable
+     * @tparam Args      the argument types of the callable
+     * @tparam Capacity  the number of bytes available for storing a callable inline
+     * @tparam Allocator the allocator used for callables that don't fit inline
+     */
+    template <typename R, typename... Args, std::size_t Capacity, typename Allocator>
+    class InlineFunction<R(Args...), Capacity, Allocator> {
+    private:
+        using Storage = std::aligned_storage_t<Capacity, alignof(std::max_align_t)>;
+
+        /// The operations that can be performed on the stored callable
+        struct Operations {
+            R (*invoke)(Storage&, Args&&...);
+            void (*move)(Storage& from, Storage& to);
+            void (*destroy)(Storage&);
+        };
+
+        /// Operations for a callable stored directly in the buffer
+        template <typename F>
+        struct Inline {
+            static F& get(Storage& storage) {
+                return *reinterpret_cast<F*>(&storage);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            }
+            template <typename G>
+            static void create(Storage& storage, G&& f) {
+                new (&storage) F(std::forward<G>(f));
+            }
+            static R invoke(Storage& storage, Args&&... args) {
+                return get(storage)(std::forward<Args>(args)...);
+            }
+            static void move(Storage& from, Storage& to) {
+                new (&to) F(std::move(get(from)));
+                get(from).~F();
+            }
+            static void destroy(Storage& storage) {
+                get(storage).~F();
+            }
+            static const Operations* operations() {
+                static const Operations ops{&invoke, &move, &destroy};
+                return &ops;
+            }
+        };
+
+        /// Operations for a callable that has been allocated elsewhere, with a pointer to it stored in the buffer
+        template <typename F>
+        struct Spilled {
+            using Alloc  = typename std::allocator_traits<Allocator>::template rebind_alloc<F>;
+            using Traits = std::allocator_traits<Alloc>;
+
+            static F*& get(Storage& storage) {
+                return *reinterpret_cast<F**>(&storage);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            }
+            template <typename G>
+            static void create(Storage& storage, G&& f) {
+                Alloc alloc;
+                F* ptr = Traits::allocate(alloc, 1);
+                try {
+                    Traits::construct(alloc, ptr, std::forward<G>(f));
+                }
+                catch (...) {
+                    Traits::deallocate(alloc, ptr, 1);
+                    throw;
+                }
+                new (&storage) F*(ptr);
+            }
+            static R invoke(Storage& storage, Args&&... args) {
+                return (*get(storage))(std::forward<Args>(args)...);
+            }
+            static void move(Storage& from, Storage& to) {
+                new (&to) F*(get(from));
+            }
+            static void destroy(Storage& storage) {
+                Alloc alloc;
+                Traits::destroy(alloc, get(storage));
+                Traits::deallocate(alloc, get(storage), 1);
+            }
+            static const Operations* operations() {
+                static const Operations ops{&invoke, &move, &destroy};
+                return &ops;
+            }
+        };
+
+        template <typename F>
+        using Holder = std::conditional_t<(sizeof(F) <= Capacity && alignof(F) <= alignof(Storage)
+                                           && std::is_nothrow_move_constructible<F>::value),
+                                          Inline<F>,
+                                          Spilled<F>>;
+
+    public:
+        /**
+         * Check if a callable of the given type will be stored inline.
+         *
+         * @tparam F the type of the callable
+         *
+         * @return true if the callable is stored inline, false if it will be allocated
+         */
+        template <typename F>
+        static constexpr bool stores_inline() {
+            return std::is_same<Holder<std::decay_t<F>>, Inline<std::decay_t<F>>>::value;
+        }
+
+        InlineFunction() noexcept = default;
+        InlineFunction(std::nullptr_t) noexcept {}  // NOLINT(google-explicit-constructor)
+
+        template <typename F,
+                  typename = std::enable_if_t<!std::is_same<std::decay_t<F>, InlineFunction>::value
+                                              && !std::is_same<std::decay_t<F>, std::nullptr_t>::value>>
+        InlineFunction(F&& f) {  // NOLINT(google-explicit-constructor,bugprone-forwarding-reference-overload)
+            using H = Holder<std::decay_t<F>>;
+            H::create(storage, std::forward<F>(f));
+            ops = H::operations();
+        }
+
+        InlineFunction(const InlineFunction&)            = delete;
+        InlineFunction& operator=(const InlineFunction&) = delete;
+
+        InlineFunction(InlineFunction&& other) noexcept {
+            take(other);
+        }
+
+        InlineFunction& operator=(InlineFunction&& other) noexcept {
+            if (this != &other) {
+                reset();
+                take(other);
+            }
+            return *this;
+        }
+
+        template <typename F,
+                  typename = std::enable_if_t<!std::is_same<std::decay_t<F>, InlineFunction>::value
+                                              && !std::is_same<std::decay_t<F>, std::nullptr_t>::value>>
+        InlineFunction& operator=(F&& f) {
+            return *this = InlineFunction(std::forward<F>(f));
+        }
+
+        InlineFunction& operator=(std::nullptr_t) noexcept {
+            reset();
+            return *this;
+        }
+
+        ~InlineFunction() {
+            reset();
+        }
+
+        /**
+         * @return true if this holds a callable
+         */
+        explicit operator bool() const noexcept {
+            return ops != nullptr;
+        }
+
+        /**
+         * Call the stored callable.
+         *
+         * @throws std::bad_function_call if there is no callable stored
+         */
+        R operator()(Args... args) const {
+            if (ops == nullptr) {
+                throw std::bad_function_call();
+            }
+            return ops->invoke(storage, std::forward<Args>(args)...);
+        }
+
+    private:
+        void take(InlineFunction& other) noexcept {
+            if (other.ops != nullptr) {
+                other.ops->move(other.storage, storage);
+                ops       = other.ops;
+                other.ops = nullptr;
+            }
+        }
+
+        void reset() noexcept {
+            if (ops != nullptr) {
+                ops->destroy(storage);
+                ops = nullptr;
+            }
+        }
+
+        /// The operations for the callable that is stored, or nullptr if nothing is stored
+        const Operations* ops{nullptr};
+        /// The memory holding either the callable itself or a pointer to it
+        mutable Storage storage;
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_INLINE_FUNCTION_HPP
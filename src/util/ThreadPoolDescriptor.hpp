@@ -40,11 +40,13 @@ namespace util {
         ThreadPoolDescriptor(std::string name,
                              const int& concurrency      = 1,
                              const bool& counts_for_idle = true,
-                             const bool& persistent      = false) noexcept
+                             const bool& persistent      = false,
+                             const bool& work_stealing   = false) noexcept
             : name(std::move(name))
             , concurrency(concurrency)
             , counts_for_idle(counts_for_idle)
-            , persistent(persistent) {}
+            , persistent(persistent)
+            , work_stealing(work_stealing) {}
 
         /// The name of this pool
         std::string name;
@@ -54,6 +56,8 @@ namespace util {
         bool counts_for_idle;
         /// If this thread pool will continue to accept tasks after shutdown and only stop when there are no more tasks
         bool persistent;
+        /// If each thread in this pool keeps its own local queues and steals from its peers when they run dry
+        bool work_stealing;
     };
 
 }  // namespace util
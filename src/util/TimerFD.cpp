@@ -0,0 +1,138 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "TimerFD.hpp"
+
+#include <chrono>
+
+#if defined(__linux__)
+
+    #include <poll.h>
+    #include <sys/eventfd.h>
+    #include <sys/prctl.h>
+    #include <sys/timerfd.h>
+    #include <unistd.h>
+
+    #include <array>
+    #include <cerrno>
+    #include <cstdint>
+    #include <ctime>
+    #include <system_error>
+
+namespace NUClear {
+namespace util {
+
+    TimerFD::TimerFD()
+        : timer(::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC))
+        , event(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) {}
+
+    bool TimerFD::valid() const {
+        return timer.valid() && event.valid();
+    }
+
+    void TimerFD::wait_for(const std::chrono::nanoseconds& duration) {
+        timespec now{};
+        ::clock_gettime(CLOCK_MONOTONIC, &now);
+
+        // Work out the absolute deadline, a deadline in the past fires immediately
+        const auto wait     = duration.count() > 0 ? duration : std::chrono::nanoseconds(0);
+        const auto deadline = std::chrono::seconds(now.tv_sec) + std::chrono::nanoseconds(now.tv_nsec) + wait;
+        const auto seconds  = std::chrono::duration_cast<std::chrono::seconds>(deadline);
+
+        itimerspec spec{};
+        spec.it_value.tv_sec  = seconds.count();
+        spec.it_value.tv_nsec = (deadline - seconds).count();
+
+        if (::timerfd_settime(timer.get(), TFD_TIMER_ABSTIME, &spec, nullptr) < 0) {
+            throw std::system_error(errno, std::system_category(), "There was an error while arming the timerfd");
+        }
+
+        sleep(true);
+    }
+
+    void TimerFD::wait() {
+        sleep(false);
+    }
+
+    void TimerFD::notify() {
+        const uint64_t val = 1;
+        if (::write(event.get(), &val, sizeof(val)) < 0 && errno != EAGAIN) {
+            throw std::system_error(errno, std::system_category(), "There was an error while writing to the eventfd");
+        }
+    }
+
+    void TimerFD::minimise_timer_slack() {
+        // A slack of 0 would reset the thread to the default, so 1ns is the smallest we can ask for
+        ::prctl(PR_SET_TIMERSLACK, 1UL);
+    }
+
+    void TimerFD::sleep(bool armed) {
+        std::array<pollfd, 2> fds{};
+        fds[0].fd     = event.get();
+        fds[0].events = POLLIN;
+        fds[1].fd     = timer.get();
+        fds[1].events = POLLIN;
+
+        while (::poll(fds.data(), armed ? 2 : 1, -1) < 0) {
+            if (errno != EINTR) {
+                throw std::system_error(errno, std::system_category(), "There was an error while polling the timerfd");
+            }
+        }
+
+        // Consume whatever woke us, both are non blocking so reading one that has not fired does nothing
+        uint64_t val = 0;
+        if (::read(event.get(), &val, sizeof(val)) < 0 && errno != EAGAIN) {
+            throw std::system_error(errno, std::system_category(), "There was an error while reading the eventfd");
+        }
+        if (armed && ::read(timer.get(), &val, sizeof(val)) < 0 && errno != EAGAIN) {
+            throw std::system_error(errno, std::system_category(), "There was an error while reading the timerfd");
+        }
+    }
+
+}  // namespace util
+}  // namespace NUClear
+
+#else
+
+namespace NUClear {
+namespace util {
+
+    TimerFD::TimerFD() = default;
+
+    bool TimerFD::valid() const {
+        return false;
+    }
+
+    void TimerFD::wait_for(const std::chrono::nanoseconds& /*duration*/) {}
+
+    void TimerFD::wait() {}
+
+    void TimerFD::notify() {}
+
+    void TimerFD::minimise_timer_slack() {}
+
+    void TimerFD::sleep(bool /*armed*/) {}
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif
@@ -0,0 +1,103 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_TIMER_FD_HPP
+#define NUCLEAR_UTIL_TIMER_FD_HPP
+
+#include <chrono>
+
+#include "FileDescriptor.hpp"
+
+namespace NUClear {
+namespace util {
+
+    /**
+     * A kernel timer that a thread can sleep on until an absolute deadline, or until another thread wakes it.
+     *
+     * On Linux this is a `timerfd` armed with `TFD_TIMER_ABSTIME` on `CLOCK_MONOTONIC` and an `eventfd` which is
+     * polled alongside it.
+     * The kernel wakes the sleeping thread at the deadline, so there is no need to spin through the last part of the
+     * wait to get an accurate wakeup.
+     *
+     * On other platforms, or if the kernel objects could not be created, `valid()` returns false and the caller is
+     * expected to fall back to another way of waiting.
+     */
+    class TimerFD {
+    public:
+        TimerFD();
+
+        /**
+         * Returns if the kernel timer is available on this system.
+         *
+         * @return `true` if `wait_for`, `wait` and `notify` can be used
+         */
+        bool valid() const;
+
+        /**
+         * Sleeps until the duration has passed or until `notify` is called.
+         *
+         * The deadline is converted to an absolute time as soon as this is called, so any time spent arming the timer
+         * does not push the wakeup later.
+         * A `notify` that happened before this call and has not yet been consumed makes this return immediately.
+         *
+         * @param duration how long to sleep for
+         */
+        void wait_for(const std::chrono::nanoseconds& duration);
+
+        /**
+         * Sleeps until `notify` is called.
+         *
+         * A `notify` that happened before this call and has not yet been consumed makes this return immediately.
+         */
+        void wait();
+
+        /**
+         * Wakes the thread sleeping in `wait_for` or `wait`, or the next thread to call them.
+         */
+        void notify();
+
+        /**
+         * Reduces the timer slack of the calling thread to the smallest value the kernel allows.
+         *
+         * By default Linux may delay a thread's timer wakeups by up to 50 microseconds so that it can group them with
+         * others. A thread that needs accurate wakeups can call this to remove most of that delay.
+         */
+        static void minimise_timer_slack();
+
+    private:
+        /**
+         * Sleeps in poll until the timer fires or a notification arrives, and then consumes both.
+         *
+         * @param armed if the timer has been armed, if not only notifications will wake the thread
+         */
+        void sleep(bool armed);
+
+        /// The timerfd that fires at the deadline
+        FileDescriptor timer;
+        /// The eventfd that is written to by notify
+        FileDescriptor event;
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_TIMER_FD_HPP
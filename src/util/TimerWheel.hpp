@@ -0,0 +1,443 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NUCLEAR_UTIL_TIMER_WHEEL_HPP
+#define NUCLEAR_UTIL_TIMER_WHEEL_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+
+#include "../clock.hpp"
+#include "../id.hpp"
+
+namespace NUClear {
+namespace util {
+
+    /**
+     * A hierarchical timing wheel that holds timers ordered by the time they are due.
+     *
+     * The wheel keeps a cursor at the time of the last timer it handed out.
+     * Each level of the wheel holds the timers whose due time first differs from the cursor at a particular bit, so
+     * level n holds timers that are between 2^(n-1) and 2^n nanoseconds past the cursor.
+     * Inserting or cancelling a timer only touches the level it belongs to, and the timers in a level are only moved
+     * to lower levels when the earliest of them is taken, so each timer moves at most once per level over its life.
+     *
+     * Timers keep their exact due time, the levels are only used to find the earliest one, so there is no loss of
+     * precision from the size of a slot like there is in a wheel with fixed width slots.
+     *
+     * Timers are indexed by id so they can be cancelled without searching for them. Several timers may share an id.
+     *
+     * @tparam T the value stored with each timer
+     */
+    template <typename T>
+    class TimerWheel {
+    public:
+        /// A timer that has been taken out of the wheel
+        struct Timer {
+            /// The id the timer was inserted with
+            NUClear::id_t id;
+            /// The time the timer is due
+            NUClear::clock::time_point time;
+            /// The value that was stored with the timer
+            T value;
+        };
+
+        TimerWheel() = default;
+        ~TimerWheel() {
+            clear();
+        }
+
+        TimerWheel(const TimerWheel&)            = delete;
+        TimerWheel(TimerWheel&&)                 = delete;
+        TimerWheel& operator=(const TimerWheel&) = delete;
+        TimerWheel& operator=(TimerWheel&&)      = delete;
+
+        /**
+         * Adds a timer to the wheel.
+         *
+         * @param id    the id the timer can be cancelled with
+         * @param time  the time the timer is due
+         * @param value the value to store with the timer
+         */
+        void insert(const NUClear::id_t& id, const NUClear::clock::time_point& time, T value) {
+            auto* node = new Node{id, to_key(time), std::move(value)};  // NOLINT(cppcoreguidelines-owning-memory)
+
+            // Add the node to the front of the chain of timers that share its id
+            auto it = by_id.find(id);
+            if (it != by_id.end()) {
+                node->id_next       = it->second;
+                it->second->id_prev = node;
+                it->second          = node;
+            }
+            else {
+                by_id.emplace(id, node);
+            }
+
+            link(node);
+            ++count;
+        }
+
+        /**
+         * Removes a timer with the given id from the wheel.
+         *
+         * If several timers share the id, the one that was inserted most recently is removed.
+         *
+         * @param id the id of the timer to remove
+         *
+         * @return true if a timer was removed
+         */
+        bool cancel(const NUClear::id_t& id) {
+            auto it = by_id.find(id);
+            if (it == by_id.end()) {
+                return false;
+            }
+            destroy(it->second);
+            return true;
+        }
+
+        /**
+         * Checks if there are no timers in the wheel.
+         *
+         * @return true if the wheel is empty
+         */
+        bool empty() const {
+            return count == 0;
+        }
+
+        /**
+         * Gets the number of timers in the wheel.
+         *
+         * @return the number of timers in the wheel
+         */
+        std::size_t size() const {
+            return count;
+        }
+
+        /**
+         * Gets the time the earliest timer is due. The wheel must not be empty.
+         *
+         * @return the time the earliest timer is due
+         */
+        NUClear::clock::time_point next() {
+            return from_key(earliest()->key);
+        }
+
+        /**
+         * Removes the earliest timer from the wheel and returns it. The wheel must not be empty.
+         *
+         * @return the earliest timer
+         */
+        Timer pop() {
+            Node* node = earliest();
+
+            // Move the cursor up to the earliest timer so that it sits in the lowest level
+            if (node->level != 0 && node->level != OVERDUE) {
+                const std::size_t level = node->level;
+                cursor                  = node->key;
+                Node* list              = levels[level];
+                clear_level(level);
+                while (list != nullptr) {
+                    Node* next = list->next;
+                    link(list);
+                    list = next;
+                }
+            }
+
+            Timer timer{node->id, from_key(node->key), std::move(node->value)};
+            destroy(node);
+            return timer;
+        }
+
+        /**
+         * Moves every timer in the wheel by the same amount without touching any of them.
+         *
+         * @param adjustment the amount to move every timer by
+         */
+        void shift(const NUClear::clock::duration& adjustment) {
+            origin += adjustment;
+        }
+
+        /**
+         * Moves the cursor back so timers at or after the given time are ordered by the levels again.
+         *
+         * The cursor never moves past the earliest timer, so timers inserted before it are kept in an unordered
+         * overdue list that is searched each time the earliest timer is needed. That is fine when those timers are
+         * already due, but after the clock is set backwards they may not be, so this rebuilds the levels around the
+         * new time. This touches every timer when it has to move the cursor, and nothing otherwise.
+         *
+         * @param time the time the cursor should be no later than
+         */
+        void rewind(const NUClear::clock::time_point& time) {
+            const uint64_t key = to_key(time);
+            if (key >= cursor) {
+                return;
+            }
+
+            // Collect every timer and link them again around the new cursor
+            Node* all = nullptr;
+            for (std::size_t level = 0; level < LEVELS; ++level) {
+                while (levels[level] != nullptr) {
+                    Node* node = levels[level];
+                    unlink(node);
+                    node->next = all;
+                    all        = node;
+                }
+            }
+            cursor = key;
+            while (all != nullptr) {
+                Node* next = all->next;
+                link(all);
+                all = next;
+            }
+        }
+
+        /**
+         * Removes every timer from the wheel.
+         */
+        void clear() {
+            for (std::size_t level = 0; level < LEVELS; ++level) {
+                while (levels[level] != nullptr) {
+                    destroy(levels[level]);
+                }
+            }
+        }
+
+    private:
+        /// Level 0 holds timers at the cursor, levels 1 to 64 hold timers by the highest bit they differ from it
+        static constexpr std::size_t OVERDUE = 65;
+        /// The total number of levels including the overdue list
+        static constexpr std::size_t LEVELS = 66;
+        /// Flipping the sign bit maps signed nanoseconds onto unsigned keys with the same order
+        static constexpr uint64_t SIGN_BIT = uint64_t(1) << 63;
+
+        struct Node {
+            Node(const NUClear::id_t& id, const uint64_t& key, T&& value)
+                : id(id), key(key), value(std::move(value)) {}
+
+            /// The id the timer was inserted with
+            NUClear::id_t id;
+            /// The time the timer is due in nanoseconds from the origin, with the sign bit flipped
+            uint64_t key;
+            /// The value stored with the timer
+            T value;
+            /// The level this node is linked into
+            std::size_t level{0};
+            /// The neighbours of this node in its level
+            Node* prev{nullptr};
+            Node* next{nullptr};
+            /// The neighbours of this node among the timers that share its id
+            Node* id_prev{nullptr};
+            Node* id_next{nullptr};
+        };
+
+        uint64_t to_key(const NUClear::clock::time_point& time) const {
+            const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(time - origin).count();
+            return uint64_t(ns) ^ SIGN_BIT;
+        }
+
+        NUClear::clock::time_point from_key(const uint64_t& key) const {
+            const auto ns = std::chrono::nanoseconds(int64_t(key ^ SIGN_BIT));
+            return origin + std::chrono::duration_cast<NUClear::clock::duration>(ns);
+        }
+
+        /**
+         * Gets the number of bits needed to hold a value, which is one more than the index of its highest set bit.
+         *
+         * @param value the value to measure, must not be zero
+         *
+         * @return the number of bits needed to hold the value
+         */
+        static std::size_t bit_width(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+            return std::size_t(64 - __builtin_clzll(value));
+#else
+            std::size_t width = 0;
+            while (value != 0) {
+                value >>= 1;
+                ++width;
+            }
+            return width;
+#endif
+        }
+
+        /**
+         * Gets the index of the lowest set bit of a value.
+         *
+         * @param value the value to search, must not be zero
+         *
+         * @return the index of the lowest set bit
+         */
+        static std::size_t lowest_bit(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+            return std::size_t(__builtin_ctzll(value));
+#else
+            std::size_t index = 0;
+            while ((value & 1) == 0) {
+                value >>= 1;
+                ++index;
+            }
+            return index;
+#endif
+        }
+
+        /**
+         * Adds a node to the level it belongs in relative to the cursor.
+         *
+         * @param node the node to add
+         */
+        void link(Node* node) {
+            const std::size_t level = node->key < cursor    ? OVERDUE
+                                      : node->key == cursor ? 0
+                                                            : bit_width(node->key ^ cursor);
+            const bool was_empty    = levels[level] == nullptr;
+            node->level             = level;
+            node->prev              = nullptr;
+            node->next              = levels[level];
+            if (!was_empty) {
+                levels[level]->prev = node;
+            }
+            levels[level] = node;
+
+            if (level != 0 && level != OVERDUE) {
+                occupied |= uint64_t(1) << (level - 1);
+                // A level whose earliest timer is unknown stays unknown until it is next needed
+                if (was_empty || (level_min[level] != nullptr && node->key < level_min[level]->key)) {
+                    level_min[level] = node;
+                }
+            }
+        }
+
+        /**
+         * Removes a node from its level without destroying it.
+         *
+         * @param node the node to remove
+         */
+        void unlink(Node* node) {
+            const std::size_t level = node->level;
+            if (node->prev != nullptr) {
+                node->prev->next = node->next;
+            }
+            else {
+                levels[level] = node->next;
+            }
+            if (node->next != nullptr) {
+                node->next->prev = node->prev;
+            }
+
+            if (level != 0 && level != OVERDUE) {
+                if (levels[level] == nullptr) {
+                    clear_level(level);
+                }
+                else if (level_min[level] == node) {
+                    // Work out the new earliest timer in this level when it is next needed
+                    level_min[level] = nullptr;
+                }
+            }
+        }
+
+        /**
+         * Marks a level as empty.
+         *
+         * @param level the level to clear
+         */
+        void clear_level(const std::size_t& level) {
+            levels[level]    = nullptr;
+            level_min[level] = nullptr;
+            occupied &= ~(uint64_t(1) << (level - 1));
+        }
+
+        /**
+         * Unlinks a node from its level and from its id chain and then deletes it.
+         *
+         * @param node the node to destroy
+         */
+        void destroy(Node* node) {
+            unlink(node);
+
+            if (node->id_prev != nullptr) {
+                node->id_prev->id_next = node->id_next;
+            }
+            if (node->id_next != nullptr) {
+                node->id_next->id_prev = node->id_prev;
+            }
+            if (node->id_prev == nullptr) {
+                if (node->id_next != nullptr) {
+                    by_id[node->id] = node->id_next;
+                }
+                else {
+                    by_id.erase(node->id);
+                }
+            }
+
+            delete node;  // NOLINT(cppcoreguidelines-owning-memory)
+            --count;
+        }
+
+        /**
+         * Finds the earliest timer in the wheel, which must not be empty.
+         *
+         * @return the node of the earliest timer
+         */
+        Node* earliest() {
+            Node* best = levels[0];
+            if (best == nullptr && occupied != 0) {
+                const std::size_t level = lowest_bit(occupied) + 1;
+                if (level_min[level] == nullptr) {
+                    Node* min = levels[level];
+                    for (Node* node = min->next; node != nullptr; node = node->next) {
+                        min = node->key < min->key ? node : min;
+                    }
+                    level_min[level] = min;
+                }
+                best = level_min[level];
+            }
+
+            // Timers inserted before the cursor are due already, so there should only ever be a few of them
+            for (Node* node = levels[OVERDUE]; node != nullptr; node = node->next) {
+                best = best == nullptr || node->key < best->key ? node : best;
+            }
+            return best;
+        }
+
+        /// The time that a key of zero nanoseconds refers to, moving this moves every timer at once
+        NUClear::clock::time_point origin{};
+        /// The key of the last timer that was taken from a level, every timer in the levels is at or after this
+        uint64_t cursor{0};
+
+        /// The timers in each level as a doubly linked list
+        std::array<Node*, LEVELS> levels{};
+        /// The earliest timer in each level, or nullptr if it needs to be worked out again
+        std::array<Node*, LEVELS> level_min{};
+        /// A bit for each of levels 1 to 64 that is set when that level has timers in it
+        uint64_t occupied{0};
+        /// The most recently inserted timer for each id, the rest of the timers with that id are chained from it
+        std::unordered_map<NUClear::id_t, Node*> by_id;
+        /// The number of timers in the wheel
+        std::size_t count{0};
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_TIMER_WHEEL_HPP
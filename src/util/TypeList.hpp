@@ -19,17 +19,34 @@
  * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
  * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  */
-
 #ifndef NUCLEAR_UTIL_TYPELIST_HPP
 #define NUCLEAR_UTIL_TYPELIST_HPP
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <mutex>
+#include <utility>
 #include <vector>
 
+#include "Epoch.hpp"
+
 namespace NUClear {
 namespace util {
 
+    /**
+     * A list of values stored per type that can be read from any thread while it is being modified.
+     *
+     * The list is copy on write. Readers take a snapshot of the current list, which stays valid and unchanged for as
+     * long as the snapshot exists, without taking any locks. Writers copy the list, modify the copy and publish it in
+     * place of the old one, which is deleted once no snapshot can still see it.
+     * Each published list is reference counted, so readers that need the list for longer than a snapshot should be
+     * held can share ownership of it instead.
+     *
+     * @tparam MapID the identifier that separates different families of lists
+     * @tparam Key   the key that identifies this list within its family
+     * @tparam Value the type of the values stored in the list
+     */
     template <typename MapID, typename Key, typename Value>
     class TypeList {
     public:
@@ -41,24 +58,151 @@ namespace util {
         TypeList operator=(const TypeList& /*other*/)     = delete;
         TypeList operator=(TypeList&& /*other*/) noexcept = delete;
 
+        /// The immutable list that is published to readers
+        using List = std::vector<Value>;
+        /// A shared reference to a published list
+        using SharedList = std::shared_ptr<const List>;
+
+        /**
+         * A view of the list as it was when the snapshot was taken.
+         *
+         * Changes made to the list after the snapshot was taken are not visible through it.
+         */
+        class Snapshot {
+        public:
+            Snapshot() : list(get_list(data.list.load(std::memory_order_seq_cst))) {}
+
+            const Value* begin() const {
+                return list == nullptr ? nullptr : list->data();
+            }
+            const Value* end() const {
+                return list == nullptr ? nullptr : list->data() + list->size();
+            }
+            std::size_t size() const {
+                return list == nullptr ? 0 : list->size();
+            }
+            bool empty() const {
+                return size() == 0;
+            }
+
+        private:
+            static const List* get_list(const SharedList* shared) {
+                return shared == nullptr ? nullptr : shared->get();
+            }
+
+            /// Keeps the list alive, this must be taken before the list is loaded
+            Epoch::Guard guard;
+            /// The list that was published when the snapshot was taken
+            const List* list;
+        };
+
     private:
+        /// The published list along with the mutex that serialises writers
+        struct Storage {
+            Storage() = default;
+            ~Storage() {
+                // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+                delete list.load(std::memory_order_acquire);
+            }
+            Storage(const Storage&)            = delete;
+            Storage(Storage&&)                 = delete;
+            Storage& operator=(const Storage&) = delete;
+            Storage& operator=(Storage&&)      = delete;
+
+            /// The current list, or nullptr if nothing has ever been added
+            std::atomic<const SharedList*> list{nullptr};
+            /// Held while a writer builds and publishes a new list
+            std::mutex mutex;
+        };
+
         /// The data variable where the data is stored for this map key
-        static std::vector<Value> data;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+        static Storage data;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+        /**
+         * Replace the published list with a modified copy of it.
+         *
+         * @param modify a function that modifies the copy, returning false if the list did not need to change
+         */
+        template <typename Modifier>
+        static void update(Modifier&& modify) {
+            const std::lock_guard<std::mutex> lock(data.mutex);
+
+            const SharedList* current = data.list.load(std::memory_order_relaxed);
+            List next                 = current == nullptr ? List() : **current;
+            if (!modify(next)) {
+                return;
+            }
+
+            // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+            data.list.store(new SharedList(std::make_shared<const List>(std::move(next))), std::memory_order_seq_cst);
+            if (current != nullptr) {
+                // Retiring the reference leaves the list itself alive for anyone that is still sharing it
+                Epoch::retire(current, [](const void* ptr) {
+                    delete static_cast<const SharedList*>(ptr);  // NOLINT(cppcoreguidelines-owning-memory)
+                });
+                // Lists change rarely and hold on to reactions, so release the old one as soon as possible
+                Epoch::reclaim();
+            }
+        }
 
     public:
         /**
-         * Gets the list that is stored in this type location.
+         * Gets a snapshot of the list that is stored in this type location.
+         *
+         * @return A snapshot of the list which can be iterated while other threads modify the list
+         */
+        static Snapshot get() {
+            return Snapshot();
+        }
+
+        /**
+         * Shares ownership of the list that is stored in this type location.
+         *
+         * Unlike a snapshot this does not hold back the deletion of anything else, so it suits readers that hold on to
+         * the list while running arbitrary code.
+         *
+         * @return The current list, or nullptr if nothing has ever been added
+         */
+        static SharedList share() {
+            const Epoch::Guard guard;
+            const SharedList* shared = data.list.load(std::memory_order_seq_cst);
+            return shared == nullptr ? nullptr : *shared;
+        }
+
+        /**
+         * Adds a value to the end of the list.
+         *
+         * @param value the value to add
+         */
+        static void add(const Value& value) {
+            update([&value](List& list) {
+                list.push_back(value);
+                return true;
+            });
+        }
+
+        /**
+         * Removes every value from the list that matches a predicate.
          *
-         * @return A reference to the vector stored in this location
+         * @param predicate a function that returns true for the values that should be removed
          */
-        static std::vector<Value>& get() {
-            return data;
+        template <typename Predicate>
+        static void remove_if(Predicate&& predicate) {
+            update([&predicate](List& list) {
+                auto it = std::remove_if(list.begin(), list.end(), predicate);
+                if (it == list.end()) {
+                    return false;
+                }
+                list.erase(it, list.end());
+                return true;
+            });
         }
     };
 
     /// Initialize our type list data
     template <typename MapID, typename Key, typename Value>
-    std::vector<Value> TypeList<MapID, Key, Value>::data;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    typename TypeList<MapID, Key, Value>::Storage  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+        TypeList<MapID, Key, Value>::data;
 
 }  // namespace util
 }  // namespace NUClear
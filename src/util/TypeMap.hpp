@@ -25,8 +25,8 @@
 
 #include <atomic>
 #include <memory>
-#include <mutex>
-#include <vector>
+
+#include "Epoch.hpp"
 
 namespace NUClear {
 namespace util {
@@ -44,14 +44,20 @@ namespace util {
      *
      * @attention
      * To future me and others who look at this code.
-     * You would think that you should use an atomic shared pointer rather than a mutex protected shared pointer.
+     * You would think that you should use an atomic shared pointer rather than a hand rolled pointer swap.
      * That would make sense, then you would potentially have a lock free implementation!
      *
      * However the implementation as seen in libc++ and libstdc++ is to use a mutex protected shared pointer anyway.
      * But worse than that, it just uses a hashmap of mutexes to protect the shared pointers.
      * Specifically it looks like they just have 0xF mutexes and they hash the pointer addresses to pick one.
      * Having only a few mutexes for the entire map is a terrible idea and causes a lot of contention.
-     * This is strictly worse than the already separated mutex per type that is achieved by this implementation.
+     *
+     * Instead the shared pointer is boxed on the heap and the box is swapped with an atomic pointer.
+     * Readers hold an Epoch::Guard while they copy the shared pointer out of the box, and writers retire the old box
+     * so it is only deleted once no reader can still be copying from it.
+     * Retired boxes are checked in batches of Epoch::RECLAIM_THRESHOLD, so a write never touches the global epoch and
+     * each writing thread holds back at most that many old values that no reader can still see.
+     * Reads are wait-free and don't write to any memory shared with other readers apart from the reference count.
      *
      * @attention
      *  Note that because this is an entirely static class, if two maps with the same MapID are used, they access the
@@ -69,10 +75,27 @@ namespace util {
         TypeMap operator=(TypeMap&& /*other*/) noexcept = delete;
 
     private:
+        /// The box that holds the stored shared pointer
+        using Box = std::shared_ptr<Value>;
+
+        /// Owns the current box so the stored value is released at program exit
+        struct Storage {
+            Storage() = default;
+            ~Storage() {
+                // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+                delete box.load(std::memory_order_acquire);
+            }
+            Storage(const Storage&)            = delete;
+            Storage(Storage&&)                 = delete;
+            Storage& operator=(const Storage&) = delete;
+            Storage& operator=(Storage&&)      = delete;
+
+            /// The current box, or nullptr if nothing has been stored yet
+            std::atomic<const Box*> box{nullptr};
+        };
+
         /// The data variable where the data is stored for this map key.
-        static std::shared_ptr<Value> data;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
-        /// The mutex that protects the data variable
-        static std::mutex data_mutex;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+        static Storage data;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
     public:
         /**
@@ -81,8 +104,12 @@ namespace util {
          * @param d A pointer to the data to be stored (the map takes ownership)
          */
         static void set(const std::shared_ptr<Value>& d) {
-            const std::lock_guard<std::mutex> lock(data_mutex);
-            data = d;
+            const Box* old = data.box.exchange(new Box(d), std::memory_order_seq_cst);  // NOLINT(*-owning-memory)
+            if (old != nullptr) {
+                Epoch::retire(old, [](const void* ptr) {
+                    delete static_cast<const Box*>(ptr);  // NOLINT(cppcoreguidelines-owning-memory)
+                });
+            }
         }
 
         /**
@@ -91,18 +118,16 @@ namespace util {
          * @return A shared_ptr to the data that was previously stored
          */
         static std::shared_ptr<Value> get() {
-            const std::lock_guard<std::mutex> lock(data_mutex);
-            return data;
+            const Epoch::Guard guard;
+            const Box* box = data.box.load(std::memory_order_seq_cst);
+            return box == nullptr ? nullptr : *box;
         }
     };
 
     /// Initialize our shared_ptr data
     template <typename MapID, typename Key, typename Value>
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-    std::shared_ptr<Value> TypeMap<MapID, Key, Value>::data;
-    template <typename MapID, typename Key, typename Value>
-    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-    std::mutex TypeMap<MapID, Key, Value>::data_mutex;
+    typename TypeMap<MapID, Key, Value>::Storage TypeMap<MapID, Key, Value>::data;
 
 }  // namespace util
 }  // namespace NUClear
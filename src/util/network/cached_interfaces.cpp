@@ -0,0 +1,296 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "cached_interfaces.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "../Epoch.hpp"
+#include "../platform.hpp"
+#include "get_interfaces.hpp"
+#include "sock_t.hpp"
+
+#ifdef __linux__
+    #include <linux/netlink.h>
+    #include <linux/rtnetlink.h>
+    #include <sys/socket.h>
+    #include <unistd.h>
+#endif
+
+namespace NUClear {
+namespace util {
+    namespace network {
+
+        namespace {
+
+            /// The longest the table can go without checking whether the interfaces have changed
+            constexpr std::chrono::seconds CHECK_INTERVAL{1};
+            /// Without netlink a refresh rebuilds the table at most this often
+            constexpr std::chrono::milliseconds MIN_REBUILD_INTERVAL{100};
+            /// The most addresses that are remembered as not being in the table
+            constexpr std::size_t MAX_UNKNOWN_ADDRESSES = 16;
+
+            /**
+             * The interfaces on the system, along with the addresses that have been looked for since and not found.
+             */
+            struct Table {
+                explicit Table(std::vector<Interface> interfaces) : interfaces(std::move(interfaces)) {}
+
+                /// The interfaces
+                std::vector<Interface> interfaces;
+                /// Addresses that weren't in the interfaces when they were refreshed for, oldest first
+                std::vector<sock_t> unknown;
+            };
+
+            /**
+             * Checks if two socket addresses have the same IP address, ignoring the port.
+             *
+             * @param a the first address
+             * @param b the second address
+             *
+             * @return `true` if they are the same IP address
+             */
+            bool same_address(const sock_t& a, const sock_t& b) {
+                if (a.sock.sa_family != b.sock.sa_family) {
+                    return false;
+                }
+                if (a.sock.sa_family == AF_INET) {
+                    return a.ipv4.sin_addr.s_addr == b.ipv4.sin_addr.s_addr;
+                }
+                if (a.sock.sa_family == AF_INET6) {
+                    return std::memcmp(&a.ipv6.sin6_addr, &b.ipv6.sin6_addr, sizeof(a.ipv6.sin6_addr)) == 0;
+                }
+                return false;
+            }
+
+            /**
+             * The published interface table along with what is needed to know when to rebuild it.
+             */
+            struct Cache {
+                Cache() {
+#ifdef __linux__
+                    // Subscribe before listing the interfaces so that no change can fall between the two
+                    netlink = ::socket(AF_NETLINK, SOCK_RAW | SOCK_NONBLOCK | SOCK_CLOEXEC, NETLINK_ROUTE);
+                    if (netlink >= 0) {
+                        sockaddr_nl addr{};
+                        addr.nl_family = AF_NETLINK;
+                        addr.nl_groups = RTMGRP_LINK | RTMGRP_IPV4_IFADDR | RTMGRP_IPV6_IFADDR;
+                        if (::bind(netlink, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+                            ::close(netlink);
+                            netlink = -1;
+                        }
+                    }
+#endif
+                    last_rebuild = std::chrono::steady_clock::now();
+                    next_check.store((last_rebuild + CHECK_INTERVAL).time_since_epoch().count(),
+                                     std::memory_order_relaxed);
+                    table.store(new Table(get_interfaces()), std::memory_order_seq_cst);  // NOLINT(*-owning-memory)
+                }
+                ~Cache() {
+#ifdef __linux__
+                    if (netlink >= 0) {
+                        ::close(netlink);
+                    }
+#endif
+                    delete table.load(std::memory_order_acquire);  // NOLINT(cppcoreguidelines-owning-memory)
+                }
+                Cache(const Cache&)            = delete;
+                Cache(Cache&&)                 = delete;
+                Cache& operator=(const Cache&) = delete;
+                Cache& operator=(Cache&&)      = delete;
+
+                /// The current interface table
+                std::atomic<const Table*> table{nullptr};
+                /// The number of times the interfaces have been listed again, remembering an address doesn't count
+                std::atomic<std::size_t> rebuilds{0};
+                /// The steady clock time after which the next lookup checks for changes
+                std::atomic<std::chrono::steady_clock::rep> next_check{0};
+                /// Held while a thread checks for changes and rebuilds the table
+                std::mutex mutex;
+                /// When the table was last rebuilt
+                std::chrono::steady_clock::time_point last_rebuild;
+#ifdef __linux__
+                /// A netlink socket subscribed to address and link changes, or -1 if one couldn't be opened
+                int netlink{-1};
+#endif
+            };
+
+            Cache& cache() {
+                static Cache instance;
+                return instance;
+            }
+
+#ifdef __linux__
+            /**
+             * Reads every pending notification from the netlink socket.
+             *
+             * @param fd the netlink socket to read from
+             *
+             * @return `true` if an address or link changed, or if notifications were lost and it can't be known
+             */
+            bool drain_netlink(const int& fd) {
+                bool changed = false;
+                alignas(nlmsghdr) char buffer[8192];
+                while (true) {
+                    const ssize_t received = ::recv(fd, buffer, sizeof(buffer), 0);
+                    if (received < 0) {
+                        if (errno == EINTR) {
+                            continue;
+                        }
+                        // ENOBUFS means the socket overflowed and some notifications were dropped
+                        return changed || (errno != EAGAIN && errno != EWOULDBLOCK);
+                    }
+                    if (received == 0) {
+                        return changed;
+                    }
+
+                    auto length = static_cast<unsigned int>(received);
+                    for (auto* msg = reinterpret_cast<nlmsghdr*>(buffer); NLMSG_OK(msg, length);
+                         msg        = NLMSG_NEXT(msg, length)) {
+                        switch (msg->nlmsg_type) {
+                            case RTM_NEWADDR:
+                            case RTM_DELADDR:
+                            case RTM_NEWLINK:
+                            case RTM_DELLINK: changed = true; break;
+                            default: break;
+                        }
+                    }
+                }
+            }
+#endif
+
+            /**
+             * Replaces the published table, the caller must hold the cache's mutex.
+             *
+             * @param c    the cache to publish the table in
+             * @param next the table to publish
+             */
+            void publish(Cache& c, std::unique_ptr<const Table> next) {
+                const Table* current = c.table.load(std::memory_order_relaxed);
+                c.table.store(next.release(), std::memory_order_seq_cst);
+                Epoch::retire(current, [](const void* ptr) {
+                    delete static_cast<const Table*>(ptr);  // NOLINT(cppcoreguidelines-owning-memory)
+                });
+                // The table is small and changes rarely, so release the old one as soon as possible
+                Epoch::reclaim();
+            }
+
+            /**
+             * Checks whether the interfaces have changed and rebuilds the table if they have.
+             *
+             * @param c    the cache to check
+             * @param wait whether to wait for another thread that is already checking, or to leave it to that thread
+             */
+            void check(Cache& c, const bool& wait) {
+                const std::size_t before = c.rebuilds.load(std::memory_order_acquire);
+
+                std::unique_lock<std::mutex> lock(c.mutex, std::defer_lock);
+                if (wait) {
+                    lock.lock();
+                }
+                else if (!lock.try_lock()) {
+                    return;
+                }
+
+                // Another thread rebuilt the table while we were waiting for it
+                if (c.rebuilds.load(std::memory_order_relaxed) != before) {
+                    return;
+                }
+
+                const auto now = std::chrono::steady_clock::now();
+                c.next_check.store((now + CHECK_INTERVAL).time_since_epoch().count(), std::memory_order_relaxed);
+
+#ifdef __linux__
+                const bool changed =
+                    c.netlink >= 0 ? drain_netlink(c.netlink) : now - c.last_rebuild >= MIN_REBUILD_INTERVAL;
+#else
+                const bool changed = now - c.last_rebuild >= MIN_REBUILD_INTERVAL;
+#endif
+                if (!changed) {
+                    return;
+                }
+
+                // A new table starts without any unknown addresses, as they may be the ones that have been added
+                c.last_rebuild = now;
+                publish(c, std::make_unique<const Table>(get_interfaces()));
+                c.rebuilds.fetch_add(1, std::memory_order_release);
+            }
+
+        }  // namespace
+
+        InterfaceSnapshot::InterfaceSnapshot()
+            : interfaces(&cache().table.load(std::memory_order_seq_cst)->interfaces) {}
+
+        InterfaceSnapshot cached_interfaces() {
+            Cache& c = cache();
+            if (std::chrono::steady_clock::now().time_since_epoch().count()
+                >= c.next_check.load(std::memory_order_relaxed)) {
+                check(c, false);
+            }
+            return {};
+        }
+
+        void refresh_interfaces() {
+            check(cache(), true);
+        }
+
+        void refresh_interfaces(const sock_t& address) {
+            Cache& c = cache();
+
+            // It has already been looked for since the table was last rebuilt
+            /* guard scope */ {
+                const Epoch::Guard guard;
+                const Table* table = c.table.load(std::memory_order_seq_cst);
+                for (const auto& unknown : table->unknown) {
+                    if (same_address(unknown, address)) {
+                        return;
+                    }
+                }
+            }
+
+            check(c, true);
+
+            // Remember it so the next lookup doesn't check again, if the table now has it this is never looked at
+            const std::lock_guard<std::mutex> lock(c.mutex);
+            const Table* current = c.table.load(std::memory_order_relaxed);
+            for (const auto& unknown : current->unknown) {
+                if (same_address(unknown, address)) {
+                    return;
+                }
+            }
+            auto next = std::make_unique<Table>(*current);
+            if (next->unknown.size() == MAX_UNKNOWN_ADDRESSES) {
+                next->unknown.erase(next->unknown.begin());
+            }
+            next->unknown.push_back(address);
+            publish(c, std::move(next));
+        }
+
+    }  // namespace network
+}  // namespace util
+}  // namespace NUClear
@@ -0,0 +1,102 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_NETWORK_CACHED_INTERFACES_HPP
+#define NUCLEAR_UTIL_NETWORK_CACHED_INTERFACES_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include "../Epoch.hpp"
+#include "get_interfaces.hpp"
+#include "sock_t.hpp"
+
+namespace NUClear {
+namespace util {
+    namespace network {
+
+        /**
+         * A view of the cached interface table as it was when the snapshot was taken.
+         *
+         * The table is read without taking any locks, and stays alive for as long as the snapshot exists even if it is
+         * replaced in the meantime.
+         */
+        class InterfaceSnapshot {
+        public:
+            InterfaceSnapshot();
+
+            const Interface* begin() const {
+                return interfaces->data();
+            }
+            const Interface* end() const {
+                return interfaces->data() + interfaces->size();
+            }
+            std::size_t size() const {
+                return interfaces->size();
+            }
+            bool empty() const {
+                return interfaces->empty();
+            }
+
+        private:
+            /// Keeps the table alive, this must be taken before the table is loaded
+            Epoch::Guard guard;
+            /// The table that was published when the snapshot was taken
+            const std::vector<Interface>* interfaces;
+        };
+
+        /**
+         * Gets the interfaces on the system from a table that is only rebuilt when they change.
+         *
+         * On Linux the table is rebuilt when a netlink notification says an address or link has changed, which is
+         * checked for at most once a second.
+         * Elsewhere the table is rebuilt once a second.
+         * Code that finds an address missing from the table can call refresh_interfaces to check again straight away.
+         *
+         * @return a snapshot of the interfaces on the system
+         */
+        InterfaceSnapshot cached_interfaces();
+
+        /**
+         * Checks whether the interfaces have changed and rebuilds the cached table if they have.
+         *
+         * If another thread is already checking this waits for it, so a snapshot taken afterwards is up to date.
+         * Where netlink isn't available the table is rebuilt unless that was done very recently, so a stream of packets
+         * for unknown addresses can't make every packet list the interfaces.
+         */
+        void refresh_interfaces();
+
+        /**
+         * Checks whether the interfaces have changed because an address wasn't found in the cached table.
+         *
+         * The address is remembered as unknown until the table is next rebuilt, when netlink reports a change or by the
+         * timed check, so a stream of packets sent to an address that isn't ours only checks for it once.
+         *
+         * @param address the address that wasn't found, only its IP address is compared
+         */
+        void refresh_interfaces(const sock_t& address);
+
+    }  // namespace network
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_NETWORK_CACHED_INTERFACES_HPP
@@ -68,7 +68,9 @@ namespace util {
 
                         Interface iface{};
 
-                        iface.name = addr->AdapterName;
+                        iface.name  = addr->AdapterName;
+                        iface.index = uaddr->Address.lpSockaddr->sa_family == AF_INET6 ? addr->Ipv6IfIndex
+                                                                                        : addr->IfIndex;
 
                         // Copy across the IP address
                         std::memcpy(&iface.ip, uaddr->Address.lpSockaddr, uaddr->Address.iSockaddrLength);
@@ -172,6 +174,7 @@ namespace util {
                         case AF_INET6: std::memcpy(&iface.ip, it->ifa_addr, sizeof(sockaddr_in6)); break;
                         default: continue;
                     }
+                    iface.index = ::if_nametoindex(it->ifa_name);
 
                     if (it->ifa_netmask != nullptr) {
                         switch (it->ifa_addr->sa_family) {
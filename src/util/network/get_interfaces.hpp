@@ -38,6 +38,8 @@ namespace util {
         struct Interface {
             /// The name of the interface
             std::string name;
+            /// The index the system uses for the interface, such as in IPv6 scope ids and multicast joins
+            unsigned int index{0};
 
             /// The address that is bound to the interface
             sock_t ip{};
@@ -31,7 +31,7 @@
 #include <vector>
 
 #include "../platform.hpp"
-#include "get_interfaces.hpp"
+#include "cached_interfaces.hpp"
 #include "sock_t.hpp"
 
 namespace NUClear {
@@ -48,14 +48,25 @@ namespace util {
             }
 
             // Find the correct interface to join on (the one that has our bind address)
-            for (const auto& iface : get_interfaces()) {
-                // iface must be, ipv6, and have the same address as our bind address
-                if (iface.ip.sock.sa_family == AF_INET6
-                    && ::memcmp(iface.ip.ipv6.sin6_addr.s6_addr, ipv6.sin6_addr.s6_addr, sizeof(in6_addr)) == 0) {
-
-                    // Get the interface for this
-                    return ::if_nametoindex(iface.name.c_str());
+            auto find = [&ipv6]() -> unsigned int {
+                for (const auto& iface : cached_interfaces()) {
+                    // iface must be, ipv6, and have the same address as our bind address
+                    if (iface.ip.sock.sa_family == AF_INET6
+                        && ::memcmp(iface.ip.ipv6.sin6_addr.s6_addr, ipv6.sin6_addr.s6_addr, sizeof(in6_addr)) == 0) {
+                        return iface.index;
+                    }
                 }
+                return 0;
+            };
+
+            // If the address isn't in the cached interfaces it may have only just been added
+            unsigned int index = find();
+            if (index == 0) {
+                refresh_interfaces();
+                index = find();
+            }
+            if (index != 0) {
+                return index;
             }
 
             // If we get here then we couldn't find an interface
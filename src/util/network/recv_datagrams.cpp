@@ -0,0 +1,268 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "recv_datagrams.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "../platform.hpp"
+#include "sock_t.hpp"
+
+namespace NUClear {
+namespace util {
+    namespace network {
+
+        namespace {
+
+            /// The space given to each datagram, which is enough for the largest UDP payload
+            constexpr std::size_t SLOT_SIZE = 65536;
+            /// The size of the memory each slab receives into
+            constexpr std::size_t SLAB_SIZE = MAX_DATAGRAMS * SLOT_SIZE;
+            /// The most memory that is kept in slabs for reuse once they are given back
+            constexpr std::size_t MAX_IDLE_BYTES = 4 * SLAB_SIZE;
+            /// The alignment of each datagram once they are packed together
+            constexpr std::size_t PACKED_ALIGNMENT = alignof(std::max_align_t);
+            /// The space given to each datagram's control messages
+            constexpr std::size_t CONTROL_SIZE = 0x100;
+
+            /**
+             * The memory that a batch of datagrams is received into, along with the headers that describe it.
+             */
+            struct Slab {
+                // The payload memory is deliberately left uninitialised so that the pages behind the slots are only
+                // touched as far as the datagrams written into them
+                // NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-c-arrays)
+                Slab() : data(new uint8_t[SLAB_SIZE]) {
+                    for (std::size_t i = 0; i < MAX_DATAGRAMS; ++i) {
+                        iov[i].iov_base = reinterpret_cast<char*>(data.get() + i * SLOT_SIZE);
+                        iov[i].iov_len  = static_cast<decltype(iov[i].iov_len)>(SLOT_SIZE);
+                    }
+                }
+
+                /// The payloads, one slot of SLOT_SIZE per datagram
+                std::unique_ptr<uint8_t[]> data;  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+                /// The buffer for each slot
+                std::array<iovec, MAX_DATAGRAMS> iov{};
+                /// The address each datagram came from
+                std::array<sock_t, MAX_DATAGRAMS> names{};
+                /// The control messages for each datagram
+                std::array<std::array<char, CONTROL_SIZE>, MAX_DATAGRAMS> control{};
+#ifdef __linux__
+                /// The headers that are given to recvmmsg
+                std::array<mmsghdr, MAX_DATAGRAMS> headers{};
+#endif
+            };
+
+            /**
+             * Slabs that have been given back and can be used for another receive.
+             *
+             * A slab is only held while datagrams are received into it, so the pool only needs as many as there are
+             * threads receiving at once.
+             */
+            struct Pool {
+                /// Held while slabs are taken from or given back to the pool
+                std::mutex mutex;
+                /// The slabs that aren't in use
+                std::vector<std::unique_ptr<Slab>> idle;
+
+                std::unique_ptr<Slab> take() {
+                    {
+                        const std::lock_guard<std::mutex> lock(mutex);
+                        if (!idle.empty()) {
+                            std::unique_ptr<Slab> slab = std::move(idle.back());
+                            idle.pop_back();
+                            return slab;
+                        }
+                    }
+                    return std::make_unique<Slab>();
+                }
+
+                void give_back(std::unique_ptr<Slab>&& slab) {
+                    const std::lock_guard<std::mutex> lock(mutex);
+                    if ((idle.size() + 1) * SLAB_SIZE <= MAX_IDLE_BYTES) {
+                        idle.push_back(std::move(slab));
+                    }
+                }
+            };
+
+            /// The pool of slabs to receive into
+            Pool& pool() {
+                static Pool instance;
+                return instance;
+            }
+
+            /**
+             * Prepares a message header to receive into one of the slab's slots.
+             *
+             * @param slab the slab to receive into
+             * @param i    the slot to receive into
+             * @param mh   the message header to prepare
+             */
+            void prepare(Slab& slab, const std::size_t& i, msghdr& mh) {
+                mh                = msghdr{};
+                mh.msg_name       = &slab.names[i].sock;
+                mh.msg_namelen    = sizeof(sock_t);
+                mh.msg_control    = slab.control[i].data();
+                mh.msg_controllen = static_cast<decltype(mh.msg_controllen)>(slab.control[i].size());
+                mh.msg_iov        = &slab.iov[i];
+                mh.msg_iovlen     = 1;
+            }
+
+            /**
+             * Fills in a received datagram from its message header.
+             *
+             * @param slab     the slab the datagram was received into
+             * @param i        the slot the datagram was received into
+             * @param mh       the message header the datagram was received with
+             * @param size     the number of bytes that were received
+             * @param bound    the address the socket is bound to
+             *
+             * @return the datagram
+             */
+            Datagram datagram(Slab& slab,
+                              const std::size_t& i,
+                              msghdr& mh,
+                              const std::size_t& size,
+                              const sock_t& bound) {
+                Datagram d{};
+                d.remote = slab.names[i];
+                d.local  = bound;
+                d.data   = slab.data.get() + i * SLOT_SIZE;
+                d.size   = size;
+
+                // Iterate through control headers to get IP information
+                for (cmsghdr* cmsg = CMSG_FIRSTHDR(&mh); cmsg != nullptr; cmsg = CMSG_NXTHDR(&mh, cmsg)) {
+                    if (d.local.sock.sa_family == AF_INET && cmsg->cmsg_level == IPPROTO_IP
+                        && cmsg->cmsg_type == IP_PKTINFO) {
+                        const auto* pi = reinterpret_cast<in_pktinfo*>(CMSG_DATA(cmsg));
+                        d.local.ipv4.sin_addr = pi->ipi_addr;
+                        break;
+                    }
+                    if (d.local.sock.sa_family == AF_INET6 && cmsg->cmsg_level == IPPROTO_IPV6
+                        && cmsg->cmsg_type == IPV6_PKTINFO) {
+                        const auto* pi        = reinterpret_cast<in6_pktinfo*>(CMSG_DATA(cmsg));
+                        d.local.ipv6.sin6_addr = pi->ipi6_addr;
+                        break;
+                    }
+                }
+
+                return d;
+            }
+
+        }  // namespace
+
+        DatagramBatch recv_datagrams(const fd_t& fd, const bool& local) {
+
+            // The local address of every datagram starts from the address the socket is bound to
+            sock_t bound{};
+            socklen_t len = sizeof(sock_t);
+            if (local && ::getsockname(fd, &bound.sock, &len) == -1) {
+                throw std::system_error(network_errno,
+                                        std::system_category(),
+                                        "Unable to get the port from the UDP socket");
+            }
+
+            Pool& p                    = pool();
+            std::unique_ptr<Slab> slab = p.take();
+
+            DatagramBatch batch;
+            batch.datagrams.reserve(MAX_DATAGRAMS);
+
+#ifdef __linux__
+            for (std::size_t i = 0; i < MAX_DATAGRAMS; ++i) {
+                prepare(*slab, i, slab->headers[i].msg_hdr);
+            }
+            const int received = ::recvmmsg(fd, slab->headers.data(), MAX_DATAGRAMS, MSG_DONTWAIT, nullptr);
+            for (int i = 0; i < received; ++i) {
+                auto& h = slab->headers[i];
+                batch.datagrams.push_back(datagram(*slab, std::size_t(i), h.msg_hdr, h.msg_len, bound));
+            }
+            batch.more = batch.datagrams.size() == MAX_DATAGRAMS;
+#else
+    #ifdef _WIN32
+            // Without MSG_DONTWAIT a receive on an empty socket blocks, so check there is a datagram and only take one
+            unsigned long available = 0;  // NOLINT(google-runtime-int) MSVC wants an unsigned long
+            ioctl(fd, FIONREAD, &available);
+            constexpr std::size_t max = 1;
+            if (available == 0) {
+                p.give_back(std::move(slab));
+                return {};
+            }
+    #else
+            constexpr std::size_t max = MAX_DATAGRAMS;
+    #endif
+            for (std::size_t i = 0; i < max; ++i) {
+                msghdr mh{};
+                prepare(*slab, i, mh);
+                const ssize_t received = recvmsg(fd, &mh, MSG_DONTWAIT);
+                if (received < 0) {
+                    break;
+                }
+                batch.datagrams.push_back(datagram(*slab, i, mh, std::size_t(received), bound));
+            }
+    #ifdef _WIN32
+            // FIONREAD counts every datagram that is waiting, so there are more if it was more than we took
+            batch.more = !batch.datagrams.empty() && available > batch.datagrams.front().size;
+    #else
+            batch.more = batch.datagrams.size() == max;
+    #endif
+#endif
+
+            if (batch.datagrams.empty()) {
+                p.give_back(std::move(slab));
+                return {};
+            }
+
+            // Pack the datagrams together so the batch only holds the memory they need and the slab can be reused now
+            auto packed_size = [](const std::size_t& size) {
+                return (size + PACKED_ALIGNMENT - 1) & ~(PACKED_ALIGNMENT - 1);
+            };
+            std::size_t total = 0;
+            for (const auto& d : batch.datagrams) {
+                total += packed_size(d.size);
+            }
+            // NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-c-arrays)
+            std::unique_ptr<uint8_t[]> packed(new uint8_t[std::max(total, std::size_t(1))]);
+            std::size_t offset = 0;
+            for (auto& d : batch.datagrams) {
+                std::memcpy(packed.get() + offset, d.data, d.size);
+                d.data = packed.get() + offset;
+                offset += packed_size(d.size);
+            }
+            p.give_back(std::move(slab));
+
+            batch.buffer = std::shared_ptr<const uint8_t>(packed.release(), std::default_delete<const uint8_t[]>());
+            return batch;
+        }
+
+    }  // namespace network
+}  // namespace util
+}  // namespace NUClear
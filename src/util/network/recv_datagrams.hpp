@@ -0,0 +1,88 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_NETWORK_RECV_DATAGRAMS_HPP
+#define NUCLEAR_UTIL_NETWORK_RECV_DATAGRAMS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "../platform.hpp"
+#include "sock_t.hpp"
+
+namespace NUClear {
+namespace util {
+    namespace network {
+
+        /// The most datagrams that a single call to recv_datagrams will receive
+        constexpr std::size_t MAX_DATAGRAMS = 32;
+
+        /**
+         * A datagram that was received by recv_datagrams.
+         *
+         * The data points into the buffer of the batch it came from and is only valid while that buffer is held.
+         */
+        struct Datagram {
+            /// The address the datagram was sent to
+            sock_t local{};
+            /// The address the datagram was sent from
+            sock_t remote{};
+            /// The payload of the datagram
+            const uint8_t* data{nullptr};
+            /// The number of bytes in the payload
+            std::size_t size{0};
+        };
+
+        /**
+         * The datagrams received by one call to recv_datagrams along with the memory that holds them.
+         */
+        struct DatagramBatch {
+            /// The datagrams in the order they were received
+            std::vector<Datagram> datagrams;
+            /// Keeps the payloads alive, they are packed together into memory that is only as large as they need
+            std::shared_ptr<const void> buffer;
+            /// If there may be more datagrams waiting that didn't fit in this batch
+            bool more{false};
+        };
+
+        /**
+         * Receives the datagrams that are waiting on a socket without blocking.
+         *
+         * Up to MAX_DATAGRAMS are received with a single recvmmsg call on Linux, and one recvmsg call each elsewhere.
+         * They are received into a slab from a shared pool, then packed together into a single allocation that is sized
+         * to fit them, so a batch doesn't hold on to space for datagrams larger than the ones that arrived.
+         * The socket must have IP_PKTINFO or IPV6_RECVPKTINFO enabled for the local addresses to be filled in.
+         *
+         * @param fd    the socket to receive from
+         * @param local whether to fill in the local addresses, which costs a getsockname call for each batch
+         *
+         * @return the datagrams that were waiting, which is empty if there were none, and if more may still be waiting
+         */
+        DatagramBatch recv_datagrams(const fd_t& fd, const bool& local = true);
+
+    }  // namespace network
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_NETWORK_RECV_DATAGRAMS_HPP
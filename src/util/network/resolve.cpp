@@ -22,12 +22,16 @@
 
 #include "resolve.hpp"
 
+#include <chrono>
 #include <cstdint>
 #include <cstring>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <system_error>
+#include <utility>
 
 #include "../platform.hpp"
 #include "sock_t.hpp"
@@ -36,6 +40,44 @@ namespace NUClear {
 namespace util {
     namespace network {
 
+        namespace {
+
+            /// How long a resolved address is reused before the resolver is asked again
+            constexpr std::chrono::seconds RESOLVE_TTL{10};
+            /// The most addresses that are remembered, the cache is emptied when it grows past this
+            constexpr std::size_t MAX_RESOLVED = 256;
+
+            /**
+             * Addresses that have been resolved recently, along with when they expire.
+             */
+            struct ResolveCache {
+                /// Held while the cache is read or modified
+                std::mutex mutex;
+                /// The resolved address for each hostname and when it stops being used
+                std::map<std::string, std::pair<sock_t, std::chrono::steady_clock::time_point>> entries;
+            };
+
+            ResolveCache& resolve_cache() {
+                static ResolveCache instance;
+                return instance;
+            }
+
+            /**
+             * Sets the port of a socket address.
+             *
+             * @param address the address to set the port of
+             * @param port    the port in host endian
+             */
+            void set_port(sock_t& address, const uint16_t& port) {
+                switch (address.sock.sa_family) {
+                    case AF_INET: address.ipv4.sin_port = htons(port); break;
+                    case AF_INET6: address.ipv6.sin6_port = htons(port); break;
+                    default: break;
+                }
+            }
+
+        }  // namespace
+
         NUClear::util::network::sock_t resolve(const std::string& address, const uint16_t& port) {
             addrinfo hints{};
             hints.ai_family   = AF_UNSPEC;  // don't care about IPv4 or IPv6
@@ -92,6 +134,31 @@ namespace util {
             return target;
         }
 
+        sock_t resolve_cached(const std::string& address, const uint16_t& port) {
+            ResolveCache& cache = resolve_cache();
+            const auto now      = std::chrono::steady_clock::now();
+
+            {
+                const std::lock_guard<std::mutex> lock(cache.mutex);
+                auto it = cache.entries.find(address);
+                if (it != cache.entries.end() && now < it->second.second) {
+                    sock_t target = it->second.first;
+                    set_port(target, port);
+                    return target;
+                }
+            }
+
+            // Resolve without holding the lock as the resolver can take a long time
+            sock_t target = resolve(address, port);
+
+            const std::lock_guard<std::mutex> lock(cache.mutex);
+            if (cache.entries.size() >= MAX_RESOLVED) {
+                cache.entries.clear();
+            }
+            cache.entries[address] = std::make_pair(target, now + RESOLVE_TTL);
+            return target;
+        }
+
     }  // namespace network
 }  // namespace util
 
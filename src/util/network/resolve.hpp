@@ -45,6 +45,19 @@ namespace util {
          */
         sock_t resolve(const std::string& address, const uint16_t& port);
 
+        /**
+         * Resolves a hostname and port into a socket address, reusing recent lookups of the same hostname.
+         *
+         * Lookups are remembered for a few seconds, so code that sends to the same host over and over only asks the
+         * resolver again once the remembered address has expired.
+         *
+         * @param address The hostname or IP address to resolve
+         * @param port    The port to connect to
+         *
+         * @return A socket address that can be used to connect to the specified host and port
+         */
+        sock_t resolve_cached(const std::string& address, const uint16_t& port);
+
     }  // namespace network
 }  // namespace util
 }  // namespace NUClear
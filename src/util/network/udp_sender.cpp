@@ -0,0 +1,275 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "udp_sender.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "../platform.hpp"
+#include "if_number_from_address.hpp"
+#include "resolve.hpp"
+#include "sock_t.hpp"
+
+namespace NUClear {
+namespace util {
+    namespace network {
+
+        namespace {
+
+            /// The most senders that are kept, the cache is emptied when it grows past this
+            constexpr std::size_t MAX_SENDERS = 64;
+
+            /// Identifies senders that can be shared, by address family, resolved from address and whether they choose
+            /// the multicast interface
+            using SenderKey = std::tuple<int, std::string, bool>;
+
+            /**
+             * The senders that are shared between packets.
+             */
+            struct SenderCache {
+                /// Held while the cache is read or modified
+                std::mutex mutex;
+                /// The shared senders
+                std::map<SenderKey, std::shared_ptr<UDPSender>> senders;
+            };
+
+            SenderCache& sender_cache() {
+                static SenderCache instance;
+                return instance;
+            }
+
+        }  // namespace
+
+        constexpr std::size_t UDPSender::MAX_BATCH;
+
+        UDPSender::UDPSender(const sock_t& local, const bool& bind, const bool& multicast)
+            : fd(::socket(local.sock.sa_family, SOCK_DGRAM, IPPROTO_UDP)) {
+
+            if (!fd.valid()) {
+                throw std::system_error(network_errno, std::system_category(), "Unable to open the UDP socket");
+            }
+
+            int yes = 1;
+            // Set reuse address and port so that emit can use the same port multiple times
+            if (::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&yes), sizeof(yes)) < 0) {
+                throw std::system_error(network_errno,
+                                        std::system_category(),
+                                        "Unable to set the reuse address option on the UDP socket");
+            }
+#ifdef SO_REUSEPORT
+            // If SO_REUSEPORT is available set it too
+            if (::setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, reinterpret_cast<const char*>(&yes), sizeof(yes)) < 0) {
+                throw std::system_error(network_errno,
+                                        std::system_category(),
+                                        "Unable to set the reuse port option on the UDP socket");
+            }
+#endif
+
+            // If we are using multicast from a specific address we need to tell the system to use the correct interface
+            if (multicast) {
+                if (local.sock.sa_family == AF_INET) {
+                    // Set our transmission interface for the multicast socket
+                    if (::setsockopt(fd,
+                                     IPPROTO_IP,
+                                     IP_MULTICAST_IF,
+                                     reinterpret_cast<const char*>(&local.ipv4.sin_addr),
+                                     sizeof(local.ipv4.sin_addr))
+                        < 0) {
+                        throw std::system_error(network_errno,
+                                                std::system_category(),
+                                                "Unable to use the requested interface for multicast");
+                    }
+                }
+                else if (local.sock.sa_family == AF_INET6) {
+                    // Set our transmission interface for the multicast socket
+                    auto if_number = if_number_from_address(local.ipv6);
+                    if (::setsockopt(fd,
+                                     IPPROTO_IPV6,
+                                     IPV6_MULTICAST_IF,
+                                     reinterpret_cast<const char*>(&if_number),
+                                     sizeof(if_number))
+                        < 0) {
+                        throw std::system_error(network_errno,
+                                                std::system_category(),
+                                                "Unable to use the requested interface for multicast");
+                    }
+                }
+            }
+
+            // Bind a local port if requested
+            if (bind && ::bind(fd, &local.sock, local.size()) != 0) {
+                throw std::system_error(network_errno,
+                                        std::system_category(),
+                                        "Unable to bind the UDP socket to the port");
+            }
+
+            // Assume that if the user is sending a broadcast they want to enable broadcasting
+            if (::setsockopt(fd, SOL_SOCKET, SO_BROADCAST, reinterpret_cast<const char*>(&yes), sizeof(yes)) < 0) {
+                throw std::system_error(network_errno,
+                                        std::system_category(),
+                                        "Unable to enable broadcasting on this socket");
+            }
+        }
+
+        void UDPSender::send(const std::vector<uint8_t>& payload, const sock_t& remote) {
+            if (::sendto(fd,
+                         reinterpret_cast<const char*>(payload.data()),
+                         static_cast<socklen_t>(payload.size()),
+                         0,
+                         &remote.sock,
+                         remote.size())
+                < 0) {
+                throw std::system_error(network_errno, std::system_category(), "Unable to send the UDP message");
+            }
+        }
+
+        void UDPSender::queue(std::vector<uint8_t>&& payload, const sock_t& remote) {
+            std::unique_lock<std::mutex> lock(mutex);
+            pending.push_back(Packet{std::move(payload), remote});
+
+            // Another thread is sending and will pick this packet up before it stops
+            if (sending) {
+                return;
+            }
+
+            // Keep sending until no more packets have been queued while we were sending
+            sending = true;
+            std::vector<Packet> packets;
+            while (!pending.empty()) {
+                packets.clear();
+                std::swap(packets, pending);
+                lock.unlock();
+                send_all(packets);
+                lock.lock();
+            }
+            sending = false;
+        }
+
+        void UDPSender::send_all(const std::vector<Packet>& packets) {
+#ifdef __linux__
+            std::array<mmsghdr, MAX_BATCH> headers{};
+            std::array<iovec, MAX_BATCH> iov{};
+
+            std::size_t sent = 0;
+            while (sent < packets.size()) {
+                const std::size_t count = std::min(packets.size() - sent, MAX_BATCH);
+                for (std::size_t i = 0; i < count; ++i) {
+                    const Packet& packet = packets[sent + i];
+                    msghdr& mh           = headers[i].msg_hdr;
+                    iov[i].iov_base      = const_cast<uint8_t*>(packet.payload.data());  // NOLINT(*-const-cast)
+                    iov[i].iov_len       = packet.payload.size();
+                    mh                   = msghdr{};
+                    mh.msg_name          = const_cast<sockaddr*>(&packet.remote.sock);  // NOLINT(*-const-cast)
+                    mh.msg_namelen       = packet.remote.size();
+                    mh.msg_iov           = &iov[i];
+                    mh.msg_iovlen        = 1;
+                }
+
+                // A packet that fails stops the call at that packet, so skip over it and carry on with the rest
+                const int result = ::sendmmsg(fd, headers.data(), static_cast<unsigned int>(count), 0);
+                sent += result > 0 ? std::size_t(result) : 1;
+            }
+#else
+            for (const auto& packet : packets) {
+                ::sendto(fd,
+                         reinterpret_cast<const char*>(packet.payload.data()),
+                         static_cast<socklen_t>(packet.payload.size()),
+                         0,
+                         &packet.remote.sock,
+                         packet.remote.size());
+            }
+#endif
+        }
+
+        std::shared_ptr<UDPSender> udp_sender(const sock_t& remote,
+                                              const std::string& from_addr,
+                                              const in_port_t& from_port) {
+
+            const bool multicast = remote.sock.sa_family == AF_INET ? ((remote.ipv4.sin_addr.s_addr >> 28) == 0xE)
+                                   : remote.sock.sa_family == AF_INET6
+                                       ? ((remote.ipv6.sin6_addr.s6_addr[0] & 0xFF) == 0xFF)
+                                       : false;
+
+            // If we are not provided a from address, use any from address
+            sock_t local{};
+            if (from_addr.empty()) {
+                // By default have the settings of local match remote (except address and port)
+                local = remote;
+                switch (local.sock.sa_family) {
+                    case AF_INET: {
+                        local.ipv4.sin_port        = htons(from_port);
+                        local.ipv4.sin_addr.s_addr = htonl(INADDR_ANY);
+                    } break;
+                    case AF_INET6: {
+                        local.ipv6.sin6_port = htons(from_port);
+                        local.ipv6.sin6_addr = IN6ADDR_ANY_INIT;
+                    } break;
+                    default: throw std::invalid_argument("Unknown socket family");
+                }
+            }
+            else {
+                local = resolve_cached(from_addr, from_port);
+                if (local.sock.sa_family != remote.sock.sa_family) {
+                    throw std::invalid_argument("to and from addresses are not the same family");
+                }
+            }
+
+            const bool bind           = !from_addr.empty() || from_port != 0;
+            const bool multicast_from = multicast && !from_addr.empty();
+
+            // A specific port is shared with other sockets so it can't be held open
+            if (from_port != 0) {
+                return std::make_shared<UDPSender>(local, bind, multicast_from);
+            }
+
+            const SenderKey key(local.sock.sa_family,
+                                std::string(reinterpret_cast<const char*>(&local.storage), local.size()),
+                                multicast_from);
+            SenderCache& cache = sender_cache();
+            const std::lock_guard<std::mutex> lock(cache.mutex);
+            auto it = cache.senders.find(key);
+            if (it != cache.senders.end()) {
+                return it->second;
+            }
+
+            if (cache.senders.size() >= MAX_SENDERS) {
+                cache.senders.clear();
+            }
+            auto sender = std::make_shared<UDPSender>(local, bind, multicast_from);
+            cache.senders.emplace(key, sender);
+            return sender;
+        }
+
+    }  // namespace network
+}  // namespace util
+}  // namespace NUClear
@@ -0,0 +1,131 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_NETWORK_UDP_SENDER_HPP
+#define NUCLEAR_UTIL_NETWORK_UDP_SENDER_HPP
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "../FileDescriptor.hpp"
+#include "../platform.hpp"
+#include "sock_t.hpp"
+
+namespace NUClear {
+namespace util {
+    namespace network {
+
+        /**
+         * A socket that UDP packets are sent from.
+         *
+         * Senders that aren't bound to a specific port are shared by every packet that is sent with the same settings,
+         * so that sending a packet doesn't have to open and set up a socket each time.
+         */
+        class UDPSender {
+        public:
+            /// The most packets that are given to the kernel in one sendmmsg call
+            static constexpr std::size_t MAX_BATCH = 64;
+
+            /**
+             * Opens a socket to send UDP packets from.
+             *
+             * @param local     the address to send from, its address family must match the packets that are sent
+             * @param bind      whether to bind the socket to the local address
+             * @param multicast whether to send multicast packets out of the interface that has the local address
+             */
+            UDPSender(const sock_t& local, const bool& bind, const bool& multicast);
+
+            /**
+             * Sends a packet straight away.
+             *
+             * @param payload the data to send
+             * @param remote  the address to send the data to
+             *
+             * @throws std::system_error if the packet could not be sent
+             */
+            void send(const std::vector<uint8_t>& payload, const sock_t& remote);
+
+            /**
+             * Sends a packet along with any others that are queued on this sender at the same time.
+             *
+             * If no other thread is sending from this sender the calling thread sends every queued packet, including
+             * packets that are queued by other threads while it is sending, in as few sendmmsg calls as it can.
+             * Otherwise the packet is queued and sent by that thread, and this returns straight away.
+             * As the packet can be sent by another thread, a failure to send it is not reported.
+             *
+             * @param payload the data to send
+             * @param remote  the address to send the data to
+             */
+            void queue(std::vector<uint8_t>&& payload, const sock_t& remote);
+
+        private:
+            /// A packet waiting to be sent
+            struct Packet {
+                /// The data to send
+                std::vector<uint8_t> payload;
+                /// The address to send the data to
+                sock_t remote;
+            };
+
+            /**
+             * Sends a list of packets, skipping any that fail.
+             *
+             * @param packets the packets to send
+             */
+            void send_all(const std::vector<Packet>& packets);
+
+            /// The socket the packets are sent from
+            FileDescriptor fd;
+            /// Held while packets are queued or taken from the queue
+            std::mutex mutex;
+            /// Packets that are waiting for the sending thread
+            std::vector<Packet> pending;
+            /// If a thread is currently sending the queued packets
+            bool sending{false};
+        };
+
+        /**
+         * Gets a sender for UDP packets to an address.
+         *
+         * Senders that don't bind to a specific port are kept and shared by every later call with the same address
+         * family, from address and multicast settings.
+         * Binding to a specific port makes a new sender each time, as a socket that is held open on a port that other
+         * sockets reuse would take some of the packets that are meant for them.
+         *
+         * @param remote    the address the packets will be sent to
+         * @param from_addr the address to send from, or an empty string to let the system choose
+         * @param from_port the port to send from in host endian, or 0 to let the system choose
+         *
+         * @return the sender to send the packets with
+         */
+        std::shared_ptr<UDPSender> udp_sender(const sock_t& remote,
+                                              const std::string& from_addr,
+                                              const in_port_t& from_port);
+
+    }  // namespace network
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_NETWORK_UDP_SENDER_HPP
@@ -41,9 +41,17 @@
 #include <string>
 #include <thread>
 #include <utility>
+#include <vector>
 
+#include "dsl/store/DataStore.hpp"
 #include "nuclear"
 
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <sys/resource.h>
+    #include <unistd.h>
+#endif
+
 namespace {
 
     /// Total number of ping-pong hops a single chain performs before it terminates.
@@ -120,9 +128,10 @@ namespace {
     };
 
     template <SyncMode mode>
-    std::int64_t run_benchmark(const int pool_concurrency, const int fanout) {
+    std::int64_t run_benchmark(const int pool_concurrency, const int fanout, const bool work_stealing) {
         NUClear::Configuration config;
-        config.default_pool_concurrency = pool_concurrency;
+        config.default_pool_concurrency   = pool_concurrency;
+        config.default_pool_work_stealing = work_stealing;
 
         NUClear::PowerPlant plant(config);
         plant.install<BenchmarkReactor<mode>>(fanout);
@@ -144,7 +153,7 @@ namespace {
     }
 
     template <SyncMode mode>
-    void run_matrix() {
+    void run_matrix(const bool work_stealing = false) {
         const int hw      = int(std::thread::hardware_concurrency());
         const int hw_half = std::max(1, hw / 2);
 
@@ -152,14 +161,15 @@ namespace {
         const std::array<int, 3> fanouts{{1, hw, hw * 4}};
 
         std::ostringstream out;
-        out << "\n=== Benchmark: " << mode_name(mode) << " (chain=" << CHAIN_LENGTH << ") ===\n";
+        out << "\n=== Benchmark: " << mode_name(mode) << (work_stealing ? "work-stealing " : "")
+            << "(chain=" << CHAIN_LENGTH << ") ===\n";
         out << std::setw(12) << "threads" << std::setw(12) << "fanout" << std::setw(12) << "µs" << "\n";
         out << "    ----------------------------------\n";
 
         std::int64_t total = 0;
         for (const int concurrency : concurrencies) {
             for (const int fanout : fanouts) {
-                const std::int64_t us = run_benchmark<mode>(concurrency, fanout);
+                const std::int64_t us = run_benchmark<mode>(concurrency, fanout, work_stealing);
                 out << std::setw(12) << concurrency << std::setw(12) << fanout << std::setw(12) << us << "\n";
                 total += us;
             }
@@ -169,6 +179,257 @@ namespace {
         std::cout << out.str() << std::endl;
     }
 
+    /// Number of DataStore reads each reader thread performs in the read scaling benchmark.
+    constexpr int READS_PER_THREAD = 1000000;
+
+    /// The message type read by the DataStore benchmark, separate from any type a reactor emits.
+    struct StoredMessage {
+        int value{};
+    };
+
+    /**
+     * Runs readers that hammer DataStore<StoredMessage>::get() while a writer replaces the value at around 1kHz.
+     *
+     * @param readers the number of reader threads
+     *
+     * @return the time taken for every reader to finish in microseconds
+     */
+    std::int64_t run_datastore_benchmark(const int readers) {
+        using Store = NUClear::dsl::store::DataStore<StoredMessage>;
+        Store::set(std::make_shared<StoredMessage>());
+
+        std::atomic<bool> done{false};
+        std::thread writer([&] {
+            int value = 0;
+            while (!done.load(std::memory_order_relaxed)) {
+                auto msg   = std::make_shared<StoredMessage>();
+                msg->value = ++value;
+                Store::set(msg);
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        });
+
+        std::atomic<int> ready{0};
+        std::atomic<bool> go{false};
+        std::atomic<std::int64_t> checksum{0};
+        std::vector<std::thread> threads;
+        for (int i = 0; i < readers; ++i) {
+            threads.emplace_back([&] {
+                ready.fetch_add(1);
+                while (!go.load()) {
+                    std::this_thread::yield();
+                }
+                std::int64_t sum = 0;
+                for (int j = 0; j < READS_PER_THREAD; ++j) {
+                    sum += Store::get()->value;
+                }
+                checksum.fetch_add(sum, std::memory_order_relaxed);
+            });
+        }
+        while (ready.load() != readers) {
+            std::this_thread::yield();
+        }
+
+        const auto start = std::chrono::high_resolution_clock::now();
+        go.store(true);
+        for (auto& t : threads) {
+            t.join();
+        }
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        done.store(true);
+        writer.join();
+
+        // Keep the reads from being optimised away
+        REQUIRE(checksum.load() >= 0);
+        return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    }
+
+    /// Number of emits each thread performs in the concurrent emit benchmark.
+    constexpr int EMITS_PER_THREAD = 200000;
+
+    /// A message type for each emitting thread so the threads only share what every emit shares.
+    template <int N>
+    struct EmitMessage {
+        int value{};
+    };
+
+    /// Emits messages of one type that nothing is subscribed to, so only the emit itself is measured.
+    template <int N>
+    void emit_messages(NUClear::PowerPlant& plant) {
+        for (int i = 0; i < EMITS_PER_THREAD; ++i) {
+            plant.emit(std::make_unique<EmitMessage<N>>());
+        }
+    }
+
+    /**
+     * Runs threads that emit as fast as they can, each to its own message type.
+     *
+     * @param emitters the number of emitting threads
+     *
+     * @return the time taken for every thread to finish in microseconds
+     */
+    std::int64_t run_emit_benchmark(const int emitters) {
+        const NUClear::Configuration config;
+        NUClear::PowerPlant plant(config);
+
+        using Emitter = void (*)(NUClear::PowerPlant&);
+        const std::array<Emitter, 8> emit_functions{{
+            &emit_messages<0>,
+            &emit_messages<1>,
+            &emit_messages<2>,
+            &emit_messages<3>,
+            &emit_messages<4>,
+            &emit_messages<5>,
+            &emit_messages<6>,
+            &emit_messages<7>,
+        }};
+
+        std::atomic<int> ready{0};
+        std::atomic<bool> go{false};
+        std::vector<std::thread> threads;
+        for (int i = 0; i < emitters; ++i) {
+            threads.emplace_back([&, i] {
+                ready.fetch_add(1);
+                while (!go.load()) {
+                    std::this_thread::yield();
+                }
+                emit_functions[std::size_t(i) % emit_functions.size()](plant);
+            });
+        }
+        while (ready.load() != emitters) {
+            std::this_thread::yield();
+        }
+
+        const auto start = std::chrono::high_resolution_clock::now();
+        go.store(true);
+        for (auto& t : threads) {
+            t.join();
+        }
+        const auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    }
+
+    /// Number of messages emitted by the fan-out benchmark.
+    constexpr int FANOUT_MESSAGES = 1000;
+
+    /// Reactor with many reactions triggered by the same message type.
+    class FanoutReactor : public NUClear::Reactor {
+    public:
+        struct FanoutMessage {};
+
+        FanoutReactor(std::unique_ptr<NUClear::Environment> environment, int subscribers)
+            : NUClear::Reactor(std::move(environment)), expected(FANOUT_MESSAGES * subscribers) {
+
+            for (int i = 0; i < subscribers; ++i) {
+                on<Trigger<FanoutMessage>>().then([this] {
+                    if (completed.fetch_add(1, std::memory_order_relaxed) + 1 == expected) {
+                        powerplant.shutdown();
+                    }
+                });
+            }
+
+            on<Startup>().then([this] {
+                for (int i = 0; i < FANOUT_MESSAGES; ++i) {
+                    emit(std::make_unique<FanoutMessage>());
+                }
+            });
+        }
+
+    private:
+        const int expected;
+        std::atomic<int> completed{0};
+    };
+
+    std::int64_t run_fanout_benchmark(const int pool_concurrency, const int subscribers) {
+        NUClear::Configuration config;
+        config.default_pool_concurrency = pool_concurrency;
+
+        NUClear::PowerPlant plant(config);
+        plant.install<FanoutReactor>(subscribers);
+
+        const auto start = std::chrono::high_resolution_clock::now();
+        plant.start();
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    }
+
+#ifndef _WIN32
+    /// Number of times the IO benchmark passes a byte between pipes.
+    constexpr int IO_HOPS = 20000;
+
+    /// Reactor that watches many pipes but only ever has one of them readable at a time.
+    class IOReactor : public NUClear::Reactor {
+    public:
+        IOReactor(std::unique_ptr<NUClear::Environment> environment, int pipes)
+            : NUClear::Reactor(std::move(environment)) {
+
+            for (int i = 0; i < pipes; ++i) {
+                std::array<int, 2> fds{-1, -1};
+                if (::pipe(fds.data()) < 0) {
+                    break;
+                }
+                ::fcntl(fds[0], F_SETFL, ::fcntl(fds[0], F_GETFL) | O_NONBLOCK);
+                ::fcntl(fds[1], F_SETFL, ::fcntl(fds[1], F_GETFL) | O_NONBLOCK);
+                readers.emplace_back(fds[0]);
+                writers.emplace_back(fds[1]);
+            }
+
+            for (std::size_t i = 0; i < readers.size(); ++i) {
+                on<IO>(readers[i].get(), IO::READ).then([this, i](const IO::Event& e) {
+                    char c = 0;
+                    if (::read(e.fd, &c, 1) <= 0) {
+                        return;
+                    }
+
+                    // Pass the byte on to a pipe somewhere else in the list
+                    if (hops.fetch_add(1, std::memory_order_relaxed) + 1 < IO_HOPS) {
+                        const std::size_t next = (i * 7919 + 1) % writers.size();
+                        if (::write(writers[next].get(), &c, 1) < 0) {
+                            powerplant.shutdown();
+                        }
+                    }
+                    else {
+                        powerplant.shutdown();
+                    }
+                });
+            }
+
+            on<Startup>().then([this] {
+                const char c = 0;
+                if (writers.empty() || ::write(writers.front().get(), &c, 1) < 0) {
+                    powerplant.shutdown();
+                }
+            });
+        }
+
+        std::size_t fds() const {
+            return readers.size() + writers.size();
+        }
+
+    private:
+        std::vector<NUClear::util::FileDescriptor> readers;
+        std::vector<NUClear::util::FileDescriptor> writers;
+        std::atomic<int> hops{0};
+    };
+
+    std::int64_t run_io_benchmark(const int pipes, std::size_t& fds) {
+        NUClear::Configuration config;
+        config.default_pool_concurrency = 2;
+
+        NUClear::PowerPlant plant(config);
+        plant.install<NUClear::extension::IOController>();
+        fds = plant.install<IOReactor>(pipes).fds();
+
+        const auto start = std::chrono::high_resolution_clock::now();
+        plant.start();
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    }
+#endif  // _WIN32
+
 }  // namespace
 
 // These cases are hidden (the leading '.' in the tag) so they do not run as part of the default
@@ -185,3 +446,92 @@ TEST_CASE("Benchmark emit ping-pong with a single sync", "[.benchmark]") {
 TEST_CASE("Benchmark emit ping-pong with two competing syncs", "[.benchmark]") {
     run_matrix<SyncMode::TWO_GROUPS>();
 }
+
+TEST_CASE("Benchmark emit ping-pong without sync on a work stealing pool", "[.benchmark]") {
+    run_matrix<SyncMode::NONE>(true);
+}
+
+TEST_CASE("Benchmark DataStore read scaling", "[.benchmark]") {
+    const int hw = int(std::thread::hardware_concurrency());
+    const std::array<int, 4> reader_counts{{1, std::max(1, hw / 2), hw, hw * 2}};
+
+    std::ostringstream out;
+    out << "\n=== Benchmark: DataStore reads (reads/thread=" << READS_PER_THREAD << ") ===\n";
+    out << std::setw(12) << "threads" << std::setw(12) << "µs" << std::setw(16) << "reads/µs" << "\n";
+    out << "    ----------------------------------------\n";
+    for (const int readers : reader_counts) {
+        const std::int64_t us = run_datastore_benchmark(readers);
+        const double rate     = double(READS_PER_THREAD) * readers / double(std::max<std::int64_t>(us, 1));
+        out << std::setw(12) << readers << std::setw(12) << us << std::setw(16) << std::fixed << std::setprecision(2)
+            << rate << "\n";
+    }
+
+    std::cout << out.str() << std::endl;
+}
+
+TEST_CASE("Benchmark concurrent emit rate", "[.benchmark]") {
+    const int hw = int(std::thread::hardware_concurrency());
+    const std::array<int, 4> emitter_counts{{1, std::max(1, hw / 2), hw, hw * 2}};
+
+    std::ostringstream out;
+    out << "\n=== Benchmark: concurrent emits (emits/thread=" << EMITS_PER_THREAD << ") ===\n";
+    out << std::setw(12) << "threads" << std::setw(12) << "µs" << std::setw(16) << "emits/µs" << "\n";
+    out << "    ----------------------------------------\n";
+    for (const int emitters : emitter_counts) {
+        const std::int64_t us = run_emit_benchmark(emitters);
+        const double rate     = double(EMITS_PER_THREAD) * emitters / double(std::max<std::int64_t>(us, 1));
+        out << std::setw(12) << emitters << std::setw(12) << us << std::setw(16) << std::fixed << std::setprecision(2)
+            << rate << "\n";
+    }
+
+    std::cout << out.str() << std::endl;
+}
+
+TEST_CASE("Benchmark emit fan-out to many subscribers", "[.benchmark]") {
+    const int hw = int(std::thread::hardware_concurrency());
+    const std::array<int, 2> concurrencies{{std::max(1, hw / 2), hw}};
+    const std::array<int, 4> subscriber_counts{{1, 4, 16, 64}};
+
+    std::ostringstream out;
+    out << "\n=== Benchmark: emit fan-out (messages=" << FANOUT_MESSAGES << ") ===\n";
+    out << std::setw(12) << "threads" << std::setw(12) << "subs" << std::setw(12) << "µs" << std::setw(16)
+        << "ns/task" << "\n";
+    out << "    ----------------------------------------------------\n";
+    for (const int concurrency : concurrencies) {
+        for (const int subscribers : subscriber_counts) {
+            const std::int64_t us = run_fanout_benchmark(concurrency, subscribers);
+            const double per_task = double(us) * 1000.0 / (double(FANOUT_MESSAGES) * subscribers);
+            out << std::setw(12) << concurrency << std::setw(12) << subscribers << std::setw(12) << us
+                << std::setw(16) << std::fixed << std::setprecision(1) << per_task << "\n";
+        }
+    }
+
+    std::cout << out.str() << std::endl;
+}
+
+#ifndef _WIN32
+TEST_CASE("Benchmark IO wakeups with many idle file descriptors", "[.benchmark]") {
+    // Make sure we are allowed enough file descriptors for the largest case
+    ::rlimit limit{};
+    if (::getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = std::min<rlim_t>(limit.rlim_max, 16384);
+        ::setrlimit(RLIMIT_NOFILE, &limit);
+    }
+
+    const std::array<int, 3> pipe_counts{{50, 500, 5000}};
+
+    std::ostringstream out;
+    out << "\n=== Benchmark: IO wakeups (hops=" << IO_HOPS << ") ===\n";
+    out << std::setw(12) << "fds" << std::setw(12) << "µs" << std::setw(16) << "ns/hop" << "\n";
+    out << "    ----------------------------------------\n";
+    for (const int pipes : pipe_counts) {
+        std::size_t fds       = 0;
+        const std::int64_t us = run_io_benchmark(pipes, fds);
+        const double per_hop  = double(us) * 1000.0 / double(IO_HOPS);
+        out << std::setw(12) << fds << std::setw(12) << us << std::setw(16) << std::fixed << std::setprecision(1)
+            << per_hop << "\n";
+    }
+
+    std::cout << out.str() << std::endl;
+}
+#endif  // _WIN32
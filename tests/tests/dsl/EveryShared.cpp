@@ -0,0 +1,97 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch2/catch_message.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "nuclear"
+#include "test_util/TestBase.hpp"
+#include "test_util/common.hpp"
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Every<20, std::chrono::milliseconds>>().then([this] {
+            ++ticks;
+            events.push_back("A " + std::to_string(ticks));
+
+            // Bind a new reaction part way through, it should join the existing timer
+            if (ticks == 3) {
+                on<Every<>>(std::chrono::milliseconds(20)).then([this] {
+                    events.push_back("C " + std::to_string(ticks));
+                    if (ticks == 8) {
+                        powerplant.shutdown();
+                    }
+                });
+            }
+        });
+
+        b_handle = on<Every<50, Per<std::chrono::seconds>>>().then([this] {
+            events.push_back("B " + std::to_string(ticks));
+            if (ticks == 5) {
+                b_handle.unbind();
+            }
+        });
+    }
+
+    /// The number of times the first reaction has run
+    int ticks = 0;
+    /// The handle of the reaction that unbinds itself
+    ReactionHandle b_handle;
+    /// Events that occur during the test
+    std::vector<std::string> events;
+};
+
+
+TEST_CASE("Every reactions with the same period run together on one timer", "[api][every][phase]") {
+
+    NUClear::Configuration config;
+    config.default_pool_concurrency = 1;
+    NUClear::PowerPlant plant(config);
+    test_util::add_tracing(plant);
+    plant.install<NUClear::extension::ChronoController>();
+    const auto& reactor = plant.install<TestReactor>();
+    plant.start();
+
+    const std::vector<std::string> expected = {
+        "A 1", "B 1",                //
+        "A 2", "B 2",                //
+        "A 3", "B 3",                //
+        "A 4", "B 4", "C 4",         //
+        "A 5", "B 5", "C 5",         //
+        "A 6", "C 6",                //
+        "A 7", "C 7",                //
+        "A 8", "C 8",                //
+    };
+
+    // Make an info print the diff in an easy to read way if we fail
+    INFO(test_util::diff_string(expected, reactor.events));
+
+    // Check the events fired in order and only those events
+    REQUIRE(reactor.events == expected);
+}
@@ -0,0 +1,126 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Windows can't do this test as it doesn't have file descriptors
+#ifndef _WIN32
+
+    #include <fcntl.h>
+    #include <unistd.h>
+
+    #include <array>
+    #include <catch2/catch_test_macros.hpp>
+    #include <chrono>
+    #include <memory>
+    #include <thread>
+    #include <utility>
+
+    #include "nuclear"
+    #include "test_util/TestBase.hpp"
+    #include "test_util/common.hpp"
+
+class TestReactor : public test_util::TestBase<TestReactor> {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment), false) {
+
+        std::array<int, 2> fds{-1, -1};
+        if (::pipe(fds.data()) < 0) {
+            return;
+        }
+        in  = fds[0];
+        out = fds[1];
+        ::fcntl(in.get(), F_SETFL, ::fcntl(in.get(), F_GETFL) | O_NONBLOCK);
+
+        on<IO>(in.get(), IO::READ).then([this](const IO::Event& e) {
+            if (drain(e.fd) == 0) {
+                ++empty_reads;
+            }
+            ++reads;
+
+            if (reads == 1) {
+                // Data that arrives while the reaction is running, and that the IO thread sees before it is read
+                write('b');
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                drain(e.fd);
+                emit(std::make_unique<Step<1>>());
+            }
+            else {
+                powerplant.shutdown();
+            }
+        });
+
+        // Give a repeated event time to arrive before the data that should fire the reaction again
+        on<Trigger<Step<1>>>().then([this] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            write('c');
+        });
+
+        on<Startup>().then([this] { write('a'); });
+    }
+
+    void write(const char& c) {
+        if (::write(out.get(), &c, 1) < 0) {
+            return;
+        }
+    }
+
+    static int drain(const NUClear::fd_t& fd) {
+        int bytes = 0;
+        char c{0};
+        while (::read(fd, &c, 1) > 0) {
+            ++bytes;
+        }
+        return bytes;
+    }
+
+    NUClear::util::FileDescriptor in;
+    NUClear::util::FileDescriptor out;
+
+    /// The number of times the reaction ran
+    int reads{0};
+    /// The number of times the reaction ran with nothing to read
+    int empty_reads{0};
+};
+
+
+TEST_CASE("IO reactions are not fired again for data they have already read", "[api][io]") {
+
+    NUClear::Configuration config;
+    config.default_pool_concurrency = 2;
+    NUClear::PowerPlant plant(config);
+    test_util::add_tracing(plant);
+    plant.install<NUClear::extension::IOController>();
+    const auto& reactor = plant.install<TestReactor>();
+    plant.start();
+
+    CHECK(reactor.reads == 2);
+    CHECK(reactor.empty_reads == 0);
+}
+
+#else
+
+    #include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("IO reactions are not fired again for data they have already read", "[api][io]") {
+    SUCCEED("This test is not supported on Windows");
+}
+
+#endif  // _WIN32
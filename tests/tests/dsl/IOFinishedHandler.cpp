@@ -0,0 +1,112 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "nuclear"
+
+namespace {
+
+struct CountingHandler : NUClear::dsl::word::IOFinishedHandler {
+    void finished(const NUClear::id_t& /*id*/) override {
+        ++calls;
+    }
+
+    std::atomic<int> calls{0};
+};
+
+}  // namespace
+
+SCENARIO("IO reactions only tell an open handler for their own powerplant", "[api][io]") {
+    using NUClear::dsl::word::IOFinishedHandler;
+
+    GIVEN("A powerplant with a handler") {
+        NUClear::PowerPlant plant;
+        CountingHandler handler;
+        IOFinishedHandler::current(plant).store(&handler);
+
+        WHEN("A reaction from the powerplant finishes") {
+            const bool told = IOFinishedHandler::notify(plant, 1);
+
+            THEN("The handler is told") {
+                CHECK(told);
+                CHECK(handler.calls == 1);
+            }
+        }
+
+        WHEN("The handler is closed while reactions are finishing") {
+            std::atomic<bool> done{false};
+            std::vector<std::thread> reactions;
+            for (int i = 0; i < 4; ++i) {
+                reactions.emplace_back([&] {
+                    while (!done) {
+                        IOFinishedHandler::notify(plant, 1);
+                    }
+                });
+            }
+            while (handler.calls == 0) {
+                std::this_thread::yield();
+            }
+            handler.close();
+            const int calls = handler.calls;
+
+            // Give any reaction that still called it the chance to show up
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            done = true;
+            for (auto& t : reactions) {
+                t.join();
+            }
+
+            THEN("Nothing calls it once close returns") {
+                CHECK(handler.calls == calls);
+                CHECK_FALSE(IOFinishedHandler::notify(plant, 1));
+            }
+        }
+
+        IOFinishedHandler::current(plant).store(nullptr);
+    }
+
+    GIVEN("A handler that was set for a powerplant that has since been destroyed") {
+        CountingHandler handler;
+        /* powerplant scope */ {
+            NUClear::PowerPlant plant;
+            IOFinishedHandler::current(plant).store(&handler);
+        }
+        NUClear::PowerPlant plant;
+
+        THEN("Reactions from the next powerplant do not tell it") {
+            CHECK_FALSE(IOFinishedHandler::notify(plant, 1));
+            CHECK(handler.calls == 0);
+        }
+    }
+
+    GIVEN("No handler") {
+        NUClear::PowerPlant plant;
+
+        THEN("Reactions have to emit IOFinished") {
+            CHECK_FALSE(IOFinishedHandler::notify(plant, 1));
+        }
+    }
+}
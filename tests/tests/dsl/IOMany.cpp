@@ -0,0 +1,131 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Windows can't do this test as it doesn't have file descriptors
+#ifndef _WIN32
+
+    #include <fcntl.h>
+    #include <unistd.h>
+
+    #include <array>
+    #include <atomic>
+    #include <catch2/catch_test_macros.hpp>
+    #include <memory>
+    #include <utility>
+    #include <vector>
+
+    #include "nuclear"
+    #include "test_util/TestBase.hpp"
+    #include "test_util/common.hpp"
+
+namespace {
+
+/// The number of pipes that are watched at once
+constexpr int N_PIPES = 128;
+
+}  // namespace
+
+class TestReactor : public test_util::TestBase<TestReactor> {
+public:
+    struct Pipe {
+        NUClear::util::FileDescriptor in;
+        NUClear::util::FileDescriptor out;
+        ReactionHandle handle;
+        int reads{0};
+    };
+
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment), false) {
+
+        pipes.resize(N_PIPES);
+        for (int i = 0; i < N_PIPES; ++i) {
+            std::array<int, 2> fds{-1, -1};
+            if (::pipe(fds.data()) < 0) {
+                return;
+            }
+            pipes[i].in  = fds[0];
+            pipes[i].out = fds[1];
+            ::fcntl(pipes[i].in.get(), F_SETFL, ::fcntl(pipes[i].in.get(), F_GETFL) | O_NONBLOCK);
+
+            pipes[i].handle = on<IO>(pipes[i].in.get(), IO::READ).then([this, i](const IO::Event& e) {
+                char c{0};
+                while (::read(e.fd, &c, 1) > 0) {
+                }
+                ++pipes[i].reads;
+                if (++total == N_PIPES + N_PIPES / 2) {
+                    powerplant.shutdown();
+                }
+                else if (total == N_PIPES) {
+                    emit(std::make_unique<Step<1>>());
+                }
+            });
+        }
+
+        // Unbind every other reaction and write to every pipe again, only the ones still bound should read
+        on<Trigger<Step<1>>, Sync<TestReactor>>().then([this] {
+            for (int i = 1; i < N_PIPES; i += 2) {
+                pipes[i].handle.unbind();
+            }
+            write_all();
+        });
+
+        on<Startup>().then([this] { write_all(); });
+    }
+
+    void write_all() {
+        for (auto& pipe : pipes) {
+            const char c = 'x';
+            if (::write(pipe.out.get(), &c, 1) < 0) {
+                return;
+            }
+        }
+    }
+
+    std::vector<Pipe> pipes;
+    std::atomic<int> total{0};
+};
+
+
+TEST_CASE("Many IO reactions can be bound and unbound", "[api][io]") {
+
+    NUClear::Configuration config;
+    config.default_pool_concurrency = 4;
+    NUClear::PowerPlant plant(config);
+    test_util::add_tracing(plant);
+    plant.install<NUClear::extension::IOController>();
+    const auto& reactor = plant.install<TestReactor>();
+    plant.start();
+
+    for (int i = 0; i < N_PIPES; ++i) {
+        INFO("Pipe " << i);
+        CHECK(reactor.pipes[i].reads == (i % 2 == 0 ? 2 : 1));
+    }
+}
+
+#else
+
+    #include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("Many IO reactions can be bound and unbound", "[api][io]") {
+    SUCCEED("This test is not supported on Windows");
+}
+
+#endif  // _WIN32
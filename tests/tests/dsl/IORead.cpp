@@ -0,0 +1,170 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Windows can't do this test as it doesn't have file descriptors
+#ifndef _WIN32
+
+    #include <fcntl.h>
+    #include <sys/socket.h>
+    #include <sys/types.h>
+    #include <unistd.h>
+
+    #include <algorithm>
+    #include <array>
+    #include <catch2/catch_message.hpp>
+    #include <catch2/catch_test_macros.hpp>
+    #include <catch2/generators/catch_generators.hpp>
+    #include <cstdlib>
+    #include <memory>
+    #include <string>
+    #include <utility>
+    #include <vector>
+
+    #include "nuclear"
+    #include "test_util/TestBase.hpp"
+    #include "test_util/common.hpp"
+
+namespace {
+
+/// The kind of file descriptor the test reads from
+std::string kind;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+/// The chunks that are written, each is written separately
+const std::vector<std::string> chunks = {"Hello", " ", "World", "!"};
+
+class TestReactor : public test_util::TestBase<TestReactor> {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment), false) {
+
+        std::array<int, 2> fds{-1, -1};
+        if (kind == "file") {
+            // A regular file is always ready, and is read until its end
+            std::array<char, 32> path{"/tmp/nuclear_ioread_XXXXXX"};
+            out = ::mkstemp(path.data());
+            in  = ::open(path.data(), O_RDONLY);
+            ::unlink(path.data());
+            for (const auto& chunk : chunks) {
+                ::write(out.get(), chunk.data(), chunk.size());
+            }
+        }
+        else {
+            const bool made = kind == "pipe"     ? ::pipe(fds.data()) == 0
+                              : kind == "stream" ? ::socketpair(AF_UNIX, SOCK_STREAM, 0, fds.data()) == 0
+                                                 : ::socketpair(AF_UNIX, SOCK_DGRAM, 0, fds.data()) == 0;
+            if (!made) {
+                return;
+            }
+            in  = fds[0];
+            out = fds[1];
+            ::fcntl(in.get(), F_SETFL, ::fcntl(in.get(), F_GETFL) | O_NONBLOCK);
+        }
+
+        on<IORead>(in.get()).then([this](const IORead::Data& data) {
+            if (data.size > 0) {
+                events.push_back("Read " + std::string(data.data, data.size));
+            }
+            else if (!data.closed) {
+                events.push_back("Empty");
+            }
+
+            // Datagrams never close, so stop once they have all arrived
+            if (data.closed || (kind == "datagram" && events.size() == chunks.size() + 1)) {
+                events.push_back("Closed");
+                // Give a reaction that wrongly runs again after the end the time to do so
+                emit<Scope::DELAY>(std::make_unique<Step<1>>(), test_util::TimeUnit(2));
+            }
+        });
+
+        on<Trigger<Step<1>>>().then([this] { powerplant.shutdown(); });
+
+        on<Startup>().then([this] {
+            if (kind == "file") {
+                return;
+            }
+            // An empty datagram is not the end of a datagram socket
+            if (kind == "datagram") {
+                ::write(out.get(), "", 0);
+            }
+            for (const auto& chunk : chunks) {
+                ::write(out.get(), chunk.data(), chunk.size());
+            }
+            if (kind != "datagram") {
+                out.close();
+            }
+        });
+    }
+
+    NUClear::util::FileDescriptor in;
+    NUClear::util::FileDescriptor out;
+
+    /// Events that occur during the test
+    std::vector<std::string> events;
+};
+
+}  // namespace
+
+TEST_CASE("Testing reading with IORead", "[api][io][ioread]") {
+
+    kind = GENERATE("pipe", "stream", "datagram", "file");
+    CAPTURE(kind);
+
+    NUClear::Configuration config;
+    config.default_pool_concurrency = 1;
+    NUClear::PowerPlant plant(config);
+    test_util::add_tracing(plant);
+    plant.install<NUClear::extension::IOController>();
+    plant.install<NUClear::extension::ChronoController>();
+    const auto& reactor = plant.install<TestReactor>();
+    plant.start();
+
+    // Streams can join writes together so only the data as a whole can be checked for them
+    std::string data;
+    for (const auto& event : reactor.events) {
+        if (event.rfind("Read ", 0) == 0) {
+            data += event.substr(5);
+        }
+    }
+
+    INFO("Events\n" << test_util::diff_string({}, reactor.events));
+    REQUIRE(data == "Hello World!");
+    REQUIRE(reactor.events.back() == "Closed");
+
+    // Once the end has been read the reaction is not run again
+    REQUIRE(std::count(reactor.events.begin(), reactor.events.end(), "Closed") == 1);
+
+    // Each datagram is its own read
+    if (kind == "datagram") {
+        const std::vector<std::string> expected = {"Empty", "Read Hello", "Read  ", "Read World", "Read !", "Closed"};
+        REQUIRE(reactor.events == expected);
+    }
+}
+
+#else
+
+    #include <catch2/catch_message.hpp>
+    #include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("Testing reading with IORead", "[api][io][ioread]") {
+    SUCCEED("This test is not supported on Windows");
+}
+
+#endif  // _WIN32
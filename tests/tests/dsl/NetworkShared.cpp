@@ -0,0 +1,127 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "nuclear"
+#include "test_util/TestBase.hpp"
+#include "test_util/common.hpp"
+#include "util/FileDescriptor.hpp"
+#include "util/network/sock_t.hpp"
+#include "util/platform.hpp"
+
+namespace {
+
+    /// The name the plant uses on the network, it hears its own announce so it can send to itself
+    const std::string NAME = "network_shared";
+
+    struct Message {
+        explicit Message(const int& value) : value(value) {}
+        int value;
+    };
+
+    /// Finds a port that nothing else is announcing on so the plant only hears itself
+    in_port_t free_port() {
+        NUClear::util::network::sock_t address{};
+        address.ipv4.sin_family      = AF_INET;
+        address.ipv4.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t len                = sizeof(address.ipv4);
+        NUClear::util::FileDescriptor fd(::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP));
+        ::bind(fd.get(), &address.sock, len);
+        ::getsockname(fd.get(), &address.sock, &len);
+        return ntohs(address.ipv4.sin_port);
+    }
+
+}  // namespace
+
+class TestReactor : public test_util::TestBase<TestReactor> {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment)
+        : TestBase(std::move(environment), false, test_util::TimeUnit(40)) {
+
+        on<Network<Message>>().then([this](const std::shared_ptr<const Message>& message) {
+            kept = message;
+            received(0, message.get());
+        });
+        on<Network<Message>>().then([this](const NetworkSource& source, const std::shared_ptr<const Message>& message) {
+            CHECK(source.name == NAME);
+            received(1, message.get());
+        });
+        on<Network<Message>>().then([this](const Message& message) {
+            received(2, &message);
+        });
+
+        // Send to ourselves once we have heard our own announce
+        on<Trigger<NUClear::message::NetworkJoin>>().then([this](const NUClear::message::NetworkJoin& join) {
+            if (join.name == NAME) {
+                emit<Scope::NETWORK>(std::make_unique<Message>(42), NAME, false);
+            }
+        });
+
+        on<Startup>().then([this] {
+            emit<Scope::INLINE>(std::make_unique<NUClear::message::NetworkConfiguration>(NAME, "127.0.0.1", port));
+
+            // The network only announces when it processes, so give it something to read
+            emit<Scope::UDP>(std::make_unique<int>(0), "127.0.0.1", port);
+        });
+    }
+
+    /// Records which message a reaction saw and stops once all of them have
+    void received(const int& reaction, const Message* message) {
+        const std::lock_guard<std::mutex> lock(mutex);
+        CHECK(message->value == 42);
+        seen[reaction] = message;
+        if (seen[0] != nullptr && seen[1] != nullptr && seen[2] != nullptr) {
+            powerplant.shutdown();
+        }
+    }
+
+    /// The port the plant announces on
+    in_port_t port = free_port();
+    /// Guards seen, the reactions can run at the same time
+    std::mutex mutex;
+    /// The message each reaction was given
+    std::array<const Message*, 3> seen{};
+    /// Keeps the first message alive so another allocation can't reuse its address
+    std::shared_ptr<const Message> kept;
+};
+
+
+TEST_CASE("Network reactions for the same type share one deserialised message", "[api][network][shared]") {
+
+    NUClear::Configuration config;
+    config.default_pool_concurrency = 2;
+    NUClear::PowerPlant plant(config);
+    test_util::add_tracing(plant);
+    plant.install<NUClear::extension::IOController>();
+    plant.install<NUClear::extension::NetworkController>();
+    const auto& reactor = plant.install<TestReactor>();
+    plant.start();
+
+    REQUIRE(reactor.seen[0] != nullptr);
+    CHECK(reactor.seen[1] == reactor.seen[0]);
+    CHECK(reactor.seen[2] == reactor.seen[0]);
+}
@@ -0,0 +1,72 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <thread>
+
+#include "nuclear"
+#include "test_util/TestBase.hpp"
+#include "test_util/common.hpp"
+
+class TestReactor : public test_util::TestBase<TestReactor> {
+public:
+    struct Message {};
+
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment)) {
+
+        on<Trigger<Message>>().then([this] { received = true; });
+
+        // Keep running after the emit, so the message can only be handled if another worker takes it
+        on<Trigger<Step<1>>>().then([this] {
+            // Give the other worker time to run out of work and go to sleep
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            emit(std::make_unique<Message>());
+
+            const auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(500);
+            while (!received && std::chrono::steady_clock::now() < end) {
+                std::this_thread::yield();
+            }
+            received_while_running = received.load();
+        });
+
+        on<Startup>().then([this] { emit(std::make_unique<Step<1>>()); });
+    }
+
+    /// If the message has been handled
+    std::atomic<bool> received{false};
+    /// If the message was handled before the reaction that emitted it finished
+    bool received_while_running{false};
+};
+
+
+TEST_CASE("A task in a busy worker's next task slot is taken by an idle worker", "[threading][LifoSlot]") {
+
+    NUClear::Configuration config;
+    config.default_pool_concurrency = 2;
+    NUClear::PowerPlant plant(config);
+    test_util::add_tracing(plant);
+    const auto& reactor = plant.install<TestReactor>();
+    plant.start();
+
+    CHECK(reactor.received_while_running);
+}
@@ -0,0 +1,117 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <utility>
+
+#include "nuclear"
+#include "test_util/TestBase.hpp"
+#include "test_util/common.hpp"
+
+namespace {
+
+/// The number of times each priority word has been asked for its priority
+std::atomic<int> static_calls{0};   // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<int> dynamic_calls{0};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<int> derived_calls{0};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+/// A priority word that declares its priority never changes
+struct StaticPriority {
+    using task_independent = StaticPriority;
+
+    template <typename DSL>
+    static int priority(const NUClear::threading::ReactionTask& /*task*/) {
+        ++static_calls;
+        return 500;
+    }
+};
+
+/// A priority word that may give a different priority for each task
+struct DynamicPriority {
+    template <typename DSL>
+    static int priority(const NUClear::threading::ReactionTask& /*task*/) {
+        ++dynamic_calls;
+        return 500;
+    }
+};
+
+/// A priority word that replaces the priority of a task independent word with one that may change for each task
+struct DerivedPriority : StaticPriority {
+    template <typename DSL>
+    static int priority(const NUClear::threading::ReactionTask& /*task*/) {
+        ++derived_calls;
+        return 500;
+    }
+};
+
+constexpr int n_messages = 10;
+
+class TestReactor : public test_util::TestBase<TestReactor> {
+public:
+    struct Message {};
+
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment)) {
+
+        on<Trigger<Message>, StaticPriority>().then([this] { ++static_runs; });
+        on<Trigger<Message>, DynamicPriority>().then([this] { ++dynamic_runs; });
+        on<Trigger<Message>, StaticPriority, DynamicPriority>().then([this] { ++mixed_runs; });
+        on<Trigger<Message>, DerivedPriority>().then([this] { ++derived_runs; });
+
+        on<Startup>().then([this] {
+            for (int i = 0; i < n_messages; ++i) {
+                emit(std::make_unique<Message>());
+            }
+        });
+    }
+
+    int static_runs  = 0;
+    int dynamic_runs = 0;
+    int mixed_runs   = 0;
+    int derived_runs = 0;
+};
+
+}  // namespace
+
+
+TEST_CASE("Task independent DSL words are only evaluated once", "[api][dsl][task_independent]") {
+
+    NUClear::Configuration config;
+    config.default_pool_concurrency = 1;
+    NUClear::PowerPlant plant(config);
+    test_util::add_tracing(plant);
+    const auto& reactor = plant.install<TestReactor>();
+    plant.start();
+
+    // Every reaction still ran once per message
+    REQUIRE(reactor.static_runs == n_messages);
+    REQUIRE(reactor.dynamic_runs == n_messages);
+    REQUIRE(reactor.mixed_runs == n_messages);
+    REQUIRE(reactor.derived_runs == n_messages);
+
+    // The static only reaction asked once, the mixed reaction asked both words for every task
+    CHECK(static_calls == 1 + n_messages);
+    CHECK(dynamic_calls == 2 * n_messages);
+
+    // The derived word doesn't inherit being task independent, so it was asked for every task
+    CHECK(derived_calls == n_messages);
+}
@@ -0,0 +1,168 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <algorithm>
+#include <catch2/catch_message.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "nuclear"
+#include "test_util/TestBase.hpp"
+#include "test_util/common.hpp"
+#include "util/FileDescriptor.hpp"
+#include "util/network/recv_datagrams.hpp"
+#include "util/platform.hpp"
+
+namespace {
+
+/// The number of packets that are sent to the batch reaction
+constexpr int PACKET_COUNT = 100;
+
+class TestReactor : public test_util::TestBase<TestReactor> {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment), false) {
+
+        auto batch = on<UDP::Batch>().then([this](const UDP::Batch::Packets& packets) {
+            batch_sizes.push_back(packets.size());
+            for (const auto& packet : packets) {
+                received.emplace_back(reinterpret_cast<const char*>(packet.data), packet.size);
+            }
+
+            if (received.size() == PACKET_COUNT) {
+                powerplant.shutdown();
+            }
+        });
+        port = std::get<1>(batch);
+    }
+
+    /// The port the batch reaction is bound to
+    in_port_t port{0};
+    /// The payloads of the packets in the order they were received
+    std::vector<std::string> received;
+    /// The number of packets in each batch the reaction was given
+    std::vector<std::size_t> batch_sizes;
+};
+
+class EmitReactor : public test_util::TestBase<EmitReactor> {
+public:
+    EmitReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment), false) {
+
+        auto batch = on<UDP::Batch>().then([this](const UDP::Batch::Packets& packets) {
+            for (const auto& packet : packets) {
+                received.emplace_back(reinterpret_cast<const char*>(packet.data), packet.size);
+            }
+
+            if (received.size() == 2 * PACKET_COUNT) {
+                powerplant.shutdown();
+            }
+        });
+        port = std::get<1>(batch);
+
+        // Emit from two threads at once so that some packets are queued while the other thread is sending
+        for (int t = 0; t < 2; ++t) {
+            on<Startup, Pool<>>().then([this, t] {
+                for (int i = 0; i < PACKET_COUNT; ++i) {
+                    emit<Scope::UDP_BATCH>(std::make_unique<std::string>(std::to_string(t) + ":" + std::to_string(i)),
+                                           "127.0.0.1",
+                                           port);
+                }
+            });
+        }
+    }
+
+    /// The port the batch reaction is bound to
+    in_port_t port{0};
+    /// The payloads of the packets in the order they were received
+    std::vector<std::string> received;
+};
+
+}  // namespace
+
+TEST_CASE("Testing receiving batches of UDP packets", "[api][network][udp][batch]") {
+
+    NUClear::Configuration config;
+    config.default_pool_concurrency = 1;
+    NUClear::PowerPlant plant(config);
+    test_util::add_tracing(plant);
+    plant.install<NUClear::extension::IOController>();
+    const auto& reactor = plant.install<TestReactor>();
+
+    // Queue every packet on the socket before the plant starts so the reaction has to receive them in batches
+    std::vector<std::string> expected;
+    NUClear::util::FileDescriptor out(::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP));
+    sockaddr_in target{};
+    target.sin_family      = AF_INET;
+    target.sin_port        = htons(reactor.port);
+    target.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    for (int i = 0; i < PACKET_COUNT; ++i) {
+        expected.push_back("Packet " + std::to_string(i));
+        ::sendto(out.get(),
+                 expected.back().data(),
+                 static_cast<int>(expected.back().size()),
+                 0,
+                 reinterpret_cast<sockaddr*>(&target),
+                 sizeof(target));
+    }
+
+    plant.start();
+
+    INFO(test_util::diff_string(expected, reactor.received));
+    REQUIRE(reactor.received == expected);
+    REQUIRE(*std::max_element(reactor.batch_sizes.begin(), reactor.batch_sizes.end())
+            <= NUClear::util::network::MAX_DATAGRAMS);
+#ifdef __linux__
+    // Everything was waiting before the first wake so the first batch is full
+    REQUIRE(reactor.batch_sizes.front() == NUClear::util::network::MAX_DATAGRAMS);
+#endif
+}
+
+TEST_CASE("Testing emitting batches of UDP packets", "[api][network][udp][batch]") {
+
+    NUClear::Configuration config;
+    config.default_pool_concurrency = 2;
+    NUClear::PowerPlant plant(config);
+    test_util::add_tracing(plant);
+    plant.install<NUClear::extension::IOController>();
+    const auto& reactor = plant.install<EmitReactor>();
+    plant.start();
+
+    // Each thread's packets arrive in the order it emitted them, but the two threads can be interleaved
+    for (int t = 0; t < 2; ++t) {
+        std::vector<std::string> expected;
+        std::vector<std::string> received;
+        for (int i = 0; i < PACKET_COUNT; ++i) {
+            expected.push_back(std::to_string(t) + ":" + std::to_string(i));
+        }
+        std::copy_if(reactor.received.begin(),
+                     reactor.received.end(),
+                     std::back_inserter(received),
+                     [t](const std::string& packet) { return packet.rfind(std::to_string(t) + ":", 0) == 0; });
+
+        INFO(test_util::diff_string(expected, received));
+        REQUIRE(received == expected);
+    }
+}
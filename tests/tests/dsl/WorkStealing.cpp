@@ -0,0 +1,145 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <atomic>
+#include <catch2/catch_message.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "nuclear"
+#include "test_util/TestBase.hpp"
+#include "test_util/common.hpp"
+
+namespace {
+
+/// Tasks emitted from a single work stealing worker must still run in priority order
+class PriorityReactor : public test_util::TestBase<PriorityReactor> {
+public:
+    struct Go {};
+    template <int I>
+    struct Message {};
+
+    PriorityReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment)) {
+
+        on<Trigger<Go>>().then([this] {
+            events.push_back("Go");
+            // Emitted from a pool worker, so these land on its local queues rather than the shared buckets
+            emit(std::make_unique<Message<0>>());
+            emit(std::make_unique<Message<1>>());
+            emit(std::make_unique<Message<2>>());
+        });
+
+        on<Trigger<Message<0>>, Priority::LOW>().then([this] { events.push_back("Low"); });
+        on<Trigger<Message<1>>>().then([this] { events.push_back("Normal"); });
+        on<Trigger<Message<2>>, Priority::HIGH>().then([this] { events.push_back("High"); });
+
+        on<Startup>().then([this] { emit(std::make_unique<Go>()); });
+    }
+
+    /// Events that occur during the test
+    std::vector<std::string> events;
+};
+
+/// Many chains bouncing through a work stealing pool, some of them synchronised
+class ChainReactor : public test_util::TestBase<ChainReactor> {
+public:
+    static constexpr int CHAINS       = 16;
+    static constexpr int CHAIN_LENGTH = 500;
+
+    struct StealingPool {
+        static constexpr const char* name   = "Stealing";
+        static constexpr int concurrency    = 4;
+        static constexpr bool work_stealing = true;
+    };
+
+    struct Hop {
+        explicit Hop(const int& remaining) : remaining(remaining) {}
+        int remaining;
+    };
+    struct SyncedHop {
+        explicit SyncedHop(const int& remaining) : remaining(remaining) {}
+        int remaining;
+    };
+
+    ChainReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment)) {
+
+        on<Trigger<Hop>, Pool<StealingPool>>().then([this](const Hop& hop) {
+            hops.fetch_add(1, std::memory_order_relaxed);
+            if (hop.remaining > 0) {
+                emit(std::make_unique<SyncedHop>(hop.remaining - 1));
+            }
+        });
+
+        on<Trigger<SyncedHop>, Pool<StealingPool>, Sync<ChainReactor>>().then([this](const SyncedHop& hop) {
+            // Sync guarantees exclusive access, so a plain increment must never lose an update
+            synced_hops = synced_hops + 1;
+            if (hop.remaining > 0) {
+                emit(std::make_unique<Hop>(hop.remaining - 1));
+            }
+        });
+
+        on<Startup>().then([this] {
+            for (int i = 0; i < CHAINS; ++i) {
+                emit(std::make_unique<Hop>(CHAIN_LENGTH - 1));
+            }
+        });
+    }
+
+    std::atomic<int> hops{0};
+    int synced_hops{0};
+};
+
+}  // namespace
+
+TEST_CASE("Tasks emitted from a work stealing worker still run in priority order", "[api][pool][work_stealing]") {
+    NUClear::Configuration config;
+    config.default_pool_concurrency   = 1;
+    config.default_pool_work_stealing = true;
+    NUClear::PowerPlant plant(config);
+    test_util::add_tracing(plant);
+    const auto& reactor = plant.install<PriorityReactor>();
+    plant.start();
+
+    const std::vector<std::string> expected = {"Go", "High", "Normal", "Low"};
+
+    // Make an info print the diff in an easy to read way if we fail
+    INFO(test_util::diff_string(expected, reactor.events));
+
+    // Check the events fired in order and only those events
+    REQUIRE(reactor.events == expected);
+}
+
+TEST_CASE("A work stealing pool runs every task and still reaches idle", "[api][pool][work_stealing]") {
+    NUClear::Configuration config;
+    config.default_pool_concurrency = 2;
+    NUClear::PowerPlant plant(config);
+    test_util::add_tracing(plant);
+    const auto& reactor = plant.install<ChainReactor>();
+    plant.start();
+
+    // Each chain alternates between the two reactions, so half of its hops are synced
+    CHECK(reactor.hops.load() == ChainReactor::CHAINS * ChainReactor::CHAIN_LENGTH / 2);
+    CHECK(reactor.synced_hops == ChainReactor::CHAINS * ChainReactor::CHAIN_LENGTH / 2);
+}
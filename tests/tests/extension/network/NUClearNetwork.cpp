@@ -0,0 +1,411 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "extension/network/NUClearNetwork.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "extension/network/wire_protocol.hpp"
+#include "util/FileDescriptor.hpp"
+#include "util/network/recv_datagrams.hpp"
+#include "util/network/sock_t.hpp"
+#include "util/platform.hpp"
+
+namespace {
+
+    using NUClear::extension::network::ACKPacket;
+    using NUClear::extension::network::AnnouncePacket;
+    using NUClear::extension::network::DataPacket;
+    using NUClear::extension::network::NACKPacket;
+    using NUClear::extension::network::NUClearNetwork;
+    using NUClear::extension::network::PacketHeader;
+    using NUClear::util::FileDescriptor;
+    using NUClear::util::network::sock_t;
+
+    /// How many bytes of a data packet come before its data
+    constexpr std::size_t DATA_HEADER = sizeof(DataPacket) - 1;
+
+    /// The hash the tests send their data with
+    constexpr uint64_t HASH = 0x0123456789ABCDEF;
+
+    /// Makes a UDP socket bound to an ephemeral port on the IPv4 loopback address
+    FileDescriptor loopback_socket(sock_t& address) {
+        FileDescriptor fd(::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP));
+        address                      = sock_t{};
+        address.ipv4.sin_family      = AF_INET;
+        address.ipv4.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t len                = sizeof(address.ipv4);
+        ::bind(fd.get(), &address.sock, len);
+        ::getsockname(fd.get(), &address.sock, &len);
+        return fd;
+    }
+
+    /// Finds a port that nothing else is announcing on so each network only hears itself and its peer
+    in_port_t free_port() {
+        sock_t address{};
+        const FileDescriptor fd = loopback_socket(address);
+        return ntohs(address.ipv4.sin_port);
+    }
+
+    /// Makes some data that is different at every offset so misplaced fragments are noticed
+    std::vector<uint8_t> make_payload(const std::size_t& size) {
+        std::vector<uint8_t> payload(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            payload[i] = uint8_t((i * 7) + (i / 251));
+        }
+        return payload;
+    }
+
+    /// Builds one fragment of a data packet the way a sender would put it on the wire
+    std::vector<uint8_t> make_fragment(const uint16_t& id,
+                                       const uint16_t& no,
+                                       const uint16_t& count,
+                                       const bool& reliable,
+                                       const uint8_t* data,
+                                       const std::size_t& length) {
+        DataPacket header;
+        header.packet_id    = id;
+        header.packet_no    = no;
+        header.packet_count = count;
+        header.reliable     = reliable;
+        header.hash         = HASH;
+
+        std::vector<uint8_t> fragment(DATA_HEADER + length);
+        std::memcpy(fragment.data(), &header, DATA_HEADER);
+        if (length > 0) {
+            std::memcpy(fragment.data() + DATA_HEADER, data, length);
+        }
+        return fragment;
+    }
+
+    /// Splits a payload into fragments of the given size like NUClearNetwork::send does
+    std::vector<std::vector<uint8_t>> split(const uint16_t& id,
+                                            const bool& reliable,
+                                            const std::vector<uint8_t>& payload,
+                                            const std::size_t& stride) {
+        const uint16_t count = uint16_t((payload.size() / stride) + 1);
+        std::vector<std::vector<uint8_t>> fragments;
+        for (uint16_t i = 0; i < count; ++i) {
+            const std::size_t offset = i * stride;
+            const std::size_t length = std::min(stride, payload.size() - offset);
+            fragments.push_back(make_fragment(id, i, count, reliable, payload.data() + offset, length));
+        }
+        return fragments;
+    }
+
+    /**
+     * A hand driven remote node made from a plain UDP socket.
+     *
+     * It announces itself to a NUClearNetwork and can then send it whatever packets a test needs and see what comes
+     * back.
+     */
+    struct Peer {
+        Peer() : fd(loopback_socket(address)) {}
+
+        /// Sends raw bytes to the given address
+        void send(const std::vector<uint8_t>& bytes, const sock_t& to) {
+            ::sendto(fd.get(),
+                     reinterpret_cast<const char*>(bytes.data()),
+                     static_cast<socklen_t>(bytes.size()),
+                     0,
+                     &to.sock,
+                     to.size());
+        }
+
+        /// Sends raw bytes to the data socket of the network we have met
+        void send(const std::vector<uint8_t>& bytes) {
+            send(bytes, remote);
+        }
+
+        /// Announces this peer to a network that announces on the given loopback port
+        void announce(const in_port_t& port) {
+            const std::string name = "peer";
+            std::vector<uint8_t> packet(sizeof(AnnouncePacket) + name.size());
+            const AnnouncePacket header;
+            std::memcpy(packet.data(), &header, sizeof(AnnouncePacket));
+            std::memcpy(packet.data() + sizeof(AnnouncePacket) - 1, name.data(), name.size());
+
+            sock_t to{};
+            to.ipv4.sin_family      = AF_INET;
+            to.ipv4.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            to.ipv4.sin_port        = htons(port);
+            send(packet, to);
+        }
+
+        /// Takes every packet that is waiting for us, remembering where the network's announce reply came from
+        std::vector<std::vector<uint8_t>> receive() {
+            std::vector<std::vector<uint8_t>> packets;
+            bool more = true;
+            while (more) {
+                const auto batch = NUClear::util::network::recv_datagrams(fd.get(), false);
+                for (const auto& datagram : batch.datagrams) {
+                    packets.emplace_back(datagram.data, datagram.data + datagram.size);
+                    if (datagram.size >= sizeof(PacketHeader)
+                        && reinterpret_cast<const PacketHeader*>(datagram.data)->type
+                               == NUClear::extension::network::ANNOUNCE) {
+                        remote = datagram.remote;
+                    }
+                }
+                more = batch.more;
+            }
+            return packets;
+        }
+
+        /// Where this peer is listening
+        sock_t address{};
+        /// The socket this peer sends and receives on
+        FileDescriptor fd;
+        /// The data socket of the network this peer has met
+        sock_t remote{};
+    };
+
+    /// Returns the packets of the given type
+    std::vector<std::vector<uint8_t>> of_type(const std::vector<std::vector<uint8_t>>& packets,
+                                              const NUClear::extension::network::Type& type) {
+        std::vector<std::vector<uint8_t>> out;
+        std::copy_if(packets.begin(), packets.end(), std::back_inserter(out), [&](const std::vector<uint8_t>& p) {
+            return p.size() >= sizeof(PacketHeader) && reinterpret_cast<const PacketHeader*>(p.data())->type == type;
+        });
+        return out;
+    }
+
+    /// A NUClearNetwork on the loopback address that has met a peer and records the packets it delivers
+    struct Network {
+        explicit Network(const uint16_t& mtu = 1500) : port(free_port()) {
+            network.set_packet_callback([this](const NUClearNetwork::NetworkTarget& /*remote*/,
+                                               const uint64_t& hash,
+                                               const bool& /*reliable*/,
+                                               std::vector<uint8_t>&& payload) {
+                if (hash == HASH) {
+                    delivered.push_back(std::move(payload));
+                }
+            });
+            network.set_join_callback([](const NUClearNetwork::NetworkTarget& /*target*/) {});
+            network.set_leave_callback([](const NUClearNetwork::NetworkTarget& /*target*/) {});
+            network.set_next_event_callback([](std::chrono::steady_clock::time_point /*time*/) {});
+            network.reset("network", "127.0.0.1", port, mtu);
+
+            // Meet the peer, which also tells the peer where our data socket is
+            peer.announce(port);
+            network.process();
+            peer.receive();
+        }
+
+        /// The announce port of the network
+        in_port_t port;
+        /// The network under test
+        NUClearNetwork network;
+        /// The remote node it talks to
+        Peer peer;
+        /// The packets the network has put back together
+        std::vector<std::vector<uint8_t>> delivered;
+    };
+
+}  // namespace
+
+SCENARIO("NUClearNetwork reassembles fragments whatever order they arrive in", "[network][NUClearNetwork]") {
+    constexpr std::size_t stride = 100;
+
+    GIVEN("A network that has met a peer") {
+        Network net;
+        REQUIRE(net.peer.remote.ipv4.sin_port != 0);
+
+        const std::size_t size = GENERATE(3 * stride + 17, 4 * stride);
+        const std::vector<uint8_t> payload = make_payload(size);
+        auto fragments                     = split(1, false, payload, stride);
+
+        const std::string order = GENERATE("in order", "reversed", "last first", "interleaved");
+        if (order == "reversed") {
+            std::reverse(fragments.begin(), fragments.end());
+        }
+        else if (order == "last first") {
+            std::rotate(fragments.begin(), std::prev(fragments.end()), fragments.end());
+        }
+        else if (order == "interleaved") {
+            std::stable_partition(fragments.begin(), fragments.end(), [&](const std::vector<uint8_t>& f) {
+                return reinterpret_cast<const DataPacket*>(f.data())->packet_no % 2 == 1;
+            });
+        }
+
+        WHEN("The " + std::to_string(size) + " byte packet is sent " + order) {
+            for (const auto& fragment : fragments) {
+                CHECK(net.delivered.empty());
+                net.peer.send(fragment);
+                net.network.process();
+            }
+
+            THEN("It is delivered once with its data in the right place") {
+                REQUIRE(net.delivered.size() == 1);
+                CHECK(net.delivered.front() == payload);
+            }
+        }
+    }
+}
+
+SCENARIO("NUClearNetwork asks for a reliable packet again when its fragments disagree", "[network][NUClearNetwork]") {
+    constexpr std::size_t stride = 100;
+
+    GIVEN("A network that has one fragment of a reliable packet") {
+        Network net;
+        const std::vector<uint8_t> payload = make_payload(3 * stride + 17);
+        const auto fragments               = split(2, true, payload, stride);
+        net.peer.send(fragments[0]);
+        net.network.process();
+
+        WHEN("A fragment that is the wrong size for the packet arrives") {
+            net.peer.send(make_fragment(2, 1, 4, true, payload.data() + stride, stride / 2));
+            net.network.process();
+
+            THEN("A NACK for the fragment it thought it had is sent back") {
+                const auto nacks = of_type(net.peer.receive(), NUClear::extension::network::NACK);
+                REQUIRE(nacks.size() == 1);
+                REQUIRE(nacks.front().size() == sizeof(NACKPacket));
+                const NACKPacket& nack = *reinterpret_cast<const NACKPacket*>(nacks.front().data());
+                CHECK(nack.packet_id == 2);
+                CHECK(nack.packet_count == 4);
+                CHECK(nack.packets == 0x01);
+            }
+
+            AND_WHEN("The packet is sent again") {
+                for (const auto& fragment : fragments) {
+                    net.peer.send(fragment);
+                    net.network.process();
+                }
+
+                THEN("The correct data is delivered") {
+                    REQUIRE(net.delivered.size() == 1);
+                    CHECK(net.delivered.front() == payload);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("NUClearNetwork ignores data packets it can't safely use", "[network][NUClearNetwork]") {
+    GIVEN("A network that has met a peer") {
+        Network net;
+
+        WHEN("A data packet too short to hold its header arrives") {
+            const auto fragment = make_fragment(3, 0, 1, true, nullptr, 0);
+            net.peer.send(std::vector<uint8_t>(fragment.begin(), std::prev(fragment.end())));
+            net.network.process();
+
+            THEN("Nothing is delivered or acknowledged") {
+                CHECK(net.delivered.empty());
+                CHECK(of_type(net.peer.receive(), NUClear::extension::network::ACK).empty());
+            }
+        }
+
+        WHEN("A fragment claims to be far into a packet that has barely started") {
+            const std::vector<uint8_t> payload = make_payload(1000);
+            net.peer.send(make_fragment(4, 0, 65535, true, payload.data(), payload.size()));
+            net.peer.send(make_fragment(4, 60000, 65535, true, payload.data(), payload.size()));
+            net.network.process();
+
+            THEN("Only the fragment that fits is acknowledged") {
+                const auto acks = of_type(net.peer.receive(), NUClear::extension::network::ACK);
+                REQUIRE(acks.size() == 1);
+                CHECK(reinterpret_cast<const ACKPacket*>(acks.front().data())->packet_no == 0);
+            }
+        }
+
+        WHEN("A dropped fragment is followed by larger fragments with the same packet id") {
+            const std::vector<uint8_t> small = make_payload(100);
+            net.peer.send(make_fragment(5, 60000, 65535, false, small.data(), small.size()));
+            net.network.process();
+
+            const std::vector<uint8_t> payload = make_payload(2 * 1400 + 17);
+            for (const auto& fragment : split(5, false, payload, 1400)) {
+                net.peer.send(fragment);
+                net.network.process();
+            }
+
+            THEN("Nothing from the dropped fragment is used to place them") {
+                REQUIRE(net.delivered.size() == 1);
+                CHECK(net.delivered.front() == payload);
+            }
+        }
+    }
+}
+
+SCENARIO("NUClearNetwork sends fragments that fill the MTU and resends the ones that are NACKed",
+         "[network][NUClearNetwork]") {
+    constexpr std::size_t stride = 200;
+
+    GIVEN("A network whose MTU leaves room for 200 bytes of data in each fragment") {
+        Network net(uint16_t(stride + DATA_HEADER + 40 + 8));
+
+        WHEN("A reliable packet that is an exact multiple of that is sent to the peer") {
+            const auto payload = std::make_shared<const std::vector<uint8_t>>(make_payload(3 * stride));
+            net.network.send(HASH, payload, "peer", true);
+            const auto sent = of_type(net.peer.receive(), NUClear::extension::network::DATA);
+
+            THEN("Every fragment is full and an empty one marks the end") {
+                REQUIRE(sent.size() == 4);
+                std::vector<uint8_t> joined;
+                for (uint16_t i = 0; i < sent.size(); ++i) {
+                    const DataPacket& header = *reinterpret_cast<const DataPacket*>(sent[i].data());
+                    CHECK(header.packet_no == i);
+                    CHECK(header.packet_count == 4);
+                    CHECK(sent[i].size() == DATA_HEADER + (i < 3 ? stride : 0));
+                    joined.insert(joined.end(), std::next(sent[i].begin(), DATA_HEADER), sent[i].end());
+                }
+                CHECK(joined == *payload);
+            }
+
+            AND_WHEN("The peer NACKs two of the fragments") {
+                const DataPacket& header = *reinterpret_cast<const DataPacket*>(sent.front().data());
+                NACKPacket nack;
+                nack.packet_id    = header.packet_id;
+                nack.packet_count = header.packet_count;
+                nack.packets      = 0x06;
+                std::vector<uint8_t> bytes(sizeof(nack));
+                std::memcpy(bytes.data(), &nack, sizeof(nack));
+                net.peer.send(bytes);
+                net.network.process();
+
+                THEN("Just those fragments are sent again") {
+                    std::set<uint16_t> resent;
+                    for (const auto& packet : net.peer.receive()) {
+                        const DataPacket& data = *reinterpret_cast<const DataPacket*>(packet.data());
+                        if (data.type == NUClear::extension::network::DATA_RETRANSMISSION) {
+                            CHECK(data.packet_id == header.packet_id);
+                            resent.insert(data.packet_no);
+                        }
+                    }
+                    CHECK(resent == std::set<uint16_t>{1, 2});
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,158 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "threading/scheduler/EventCount.hpp"
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace NUClear {
+namespace threading {
+    namespace scheduler {
+
+        SCENARIO("A notify after prepare_wait stops the wait from sleeping", "[threading][scheduler][EventCount]") {
+            GIVEN("An eventcount") {
+                EventCount event;
+
+                WHEN("A thread prepares to wait and is notified before it waits") {
+                    const auto key = event.prepare_wait();
+                    event.notify_one();
+
+                    THEN("The wait returns immediately") {
+                        event.wait(key);
+                        SUCCEED();
+                    }
+                }
+
+                WHEN("A thread prepares to wait and then cancels") {
+                    const auto key = event.prepare_wait();
+                    event.cancel_wait();
+
+                    AND_WHEN("Another thread prepares to wait and is notified") {
+                        const auto next = event.prepare_wait();
+                        event.notify_all();
+
+                        THEN("The cancelled wait doesn't stop the notify reaching the new waiter") {
+                            CHECK(key == next);
+                            event.wait(next);
+                            SUCCEED();
+                        }
+                    }
+                }
+            }
+        }
+
+        SCENARIO("Threads sleeping on an eventcount are woken without losing a notification",
+                 "[threading][scheduler][EventCount]") {
+            GIVEN("An eventcount, a shared counter and several consumers") {
+                constexpr int consumers = 4;
+                constexpr int items     = 10000;
+
+                EventCount event;
+                std::atomic<int> available{0};
+                std::atomic<int> consumed{0};
+                std::atomic<bool> done{false};
+
+                // Each consumer takes an item if one is available and otherwise follows the prepare/check/wait protocol
+                auto consume = [&] {
+                    while (true) {
+                        int n = available.load();
+                        while (n > 0 && !available.compare_exchange_weak(n, n - 1)) {
+                        }
+                        if (n > 0) {
+                            consumed.fetch_add(1);
+                            continue;
+                        }
+
+                        const auto key = event.prepare_wait();
+                        if (available.load() > 0 || done.load()) {
+                            event.cancel_wait();
+                            if (done.load() && available.load() == 0) {
+                                return;
+                            }
+                            continue;
+                        }
+                        event.wait(key);
+                    }
+                };
+
+                WHEN("A producer publishes items one at a time and notifies after each") {
+                    std::vector<std::thread> threads;
+                    for (int i = 0; i < consumers; ++i) {
+                        threads.emplace_back(consume);
+                    }
+                    for (int i = 0; i < items; ++i) {
+                        available.fetch_add(1);
+                        event.notify_one();
+                    }
+
+                    // Wait for everything to be consumed, if a wakeup were lost this would never finish
+                    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+                    while (consumed.load() < items && std::chrono::steady_clock::now() < deadline) {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    }
+                    done.store(true);
+                    event.notify_all();
+                    for (auto& thread : threads) {
+                        thread.join();
+                    }
+
+                    THEN("Every item is consumed") {
+                        CHECK(consumed.load() == items);
+                    }
+                }
+
+                WHEN("A producer publishes items in batches and notifies once per batch") {
+                    constexpr int batch = 8;
+
+                    std::vector<std::thread> threads;
+                    for (int i = 0; i < consumers; ++i) {
+                        threads.emplace_back(consume);
+                    }
+                    for (int i = 0; i < items; i += batch) {
+                        available.fetch_add(batch);
+                        event.notify_n(batch);
+                    }
+
+                    // Wait for everything to be consumed, if a wakeup were lost this would never finish
+                    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+                    while (consumed.load() < items && std::chrono::steady_clock::now() < deadline) {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    }
+                    done.store(true);
+                    event.notify_all();
+                    for (auto& thread : threads) {
+                        thread.join();
+                    }
+
+                    THEN("Every item is consumed") {
+                        CHECK(consumed.load() == items);
+                    }
+                }
+            }
+        }
+
+    }  // namespace scheduler
+}  // namespace threading
+}  // namespace NUClear
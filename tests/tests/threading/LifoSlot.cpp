@@ -0,0 +1,149 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "threading/scheduler/queue/LifoSlot.hpp"
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace NUClear {
+namespace threading {
+    namespace scheduler {
+        namespace queue {
+
+            namespace {
+                /// Stand in for a ReactionTask, aligned so the slot has room for its bucket tag
+                struct Item {
+                    explicit Item(const int& value) : value(value) {}
+                    int64_t value;
+                };
+            }  // namespace
+
+            SCENARIO("A LifoSlot holds a single task for one priority bucket", "[threading][queue][LifoSlot]") {
+                GIVEN("An empty slot") {
+                    LifoSlot<Item> slot;
+
+                    WHEN("The owner offers a task") {
+                        auto first = std::make_unique<Item>(1);
+                        REQUIRE(slot.offer(first, 2));
+
+                        THEN("The slot took ownership of it") {
+                            CHECK(first == nullptr);
+                        }
+
+                        AND_WHEN("The owner offers another task") {
+                            auto second = std::make_unique<Item>(2);
+
+                            THEN("It is refused and left with the caller") {
+                                CHECK_FALSE(slot.offer(second, 2));
+                                REQUIRE(second != nullptr);
+                                CHECK(second->value == 2);
+                            }
+                        }
+
+                        AND_WHEN("A task is taken from a different bucket") {
+                            std::unique_ptr<Item> out;
+
+                            THEN("Nothing is taken") {
+                                CHECK_FALSE(slot.take(1, out));
+                                CHECK(out == nullptr);
+                            }
+                        }
+
+                        AND_WHEN("A task is taken from the same bucket") {
+                            std::unique_ptr<Item> out;
+                            REQUIRE(slot.take(2, out));
+
+                            THEN("The original task comes back and the slot is empty") {
+                                REQUIRE(out != nullptr);
+                                CHECK(out->value == 1);
+                                std::unique_ptr<Item> again;
+                                CHECK_FALSE(slot.take_any(again));
+                            }
+                        }
+                    }
+                }
+            }
+
+            SCENARIO("A LifoSlot hands each task to exactly one taker", "[threading][queue][LifoSlot]") {
+                GIVEN("An owner repeatedly filling a slot and several thieves emptying it") {
+                    constexpr int items   = 20000;
+                    constexpr int thieves = 4;
+
+                    LifoSlot<Item> slot;
+                    std::vector<std::atomic<int>> seen(items);
+                    std::atomic<bool> done{false};
+
+                    auto record = [&](const std::unique_ptr<Item>& item) {
+                        seen[static_cast<std::size_t>(item->value)].fetch_add(1);
+                    };
+
+                    WHEN("They run concurrently") {
+                        std::vector<std::thread> threads;
+                        for (int t = 0; t < thieves; ++t) {
+                            threads.emplace_back([&] {
+                                std::unique_ptr<Item> out;
+                                while (!done.load()) {
+                                    if (slot.take_any(out)) {
+                                        record(out);
+                                    }
+                                }
+                            });
+                        }
+
+                        std::unique_ptr<Item> out;
+                        for (int i = 0; i < items; ++i) {
+                            auto item = std::make_unique<Item>(i);
+                            while (!slot.offer(item, static_cast<std::size_t>(i % 5))) {
+                                // Sometimes the owner takes its own task back, as a worker does after its current task
+                                if (slot.take(static_cast<std::size_t>((i - 1) % 5), out)) {
+                                    record(out);
+                                }
+                            }
+                        }
+                        done.store(true);
+                        for (auto& thread : threads) {
+                            thread.join();
+                        }
+                        if (slot.take_any(out)) {
+                            record(out);
+                        }
+
+                        THEN("Every task was taken exactly once") {
+                            int wrong = 0;
+                            for (const auto& s : seen) {
+                                wrong += s.load() == 1 ? 0 : 1;
+                            }
+                            CHECK(wrong == 0);
+                        }
+                    }
+                }
+            }
+
+        }  // namespace queue
+    }  // namespace scheduler
+}  // namespace threading
+}  // namespace NUClear
@@ -26,6 +26,7 @@
 #include <memory>
 #include <set>
 #include <stdexcept>
+#include <vector>
 
 #include "threading/ReactionTask.hpp"
 #include "util/GroupDescriptor.hpp"
@@ -87,6 +88,26 @@ namespace threading {
             }
         }
 
+        SCENARIO("A batch submit still runs inline tasks and ignores null tasks", "[threading][scheduler][Scheduler]") {
+            GIVEN("A scheduler and a group with a free token") {
+                Scheduler scheduler(1);
+                auto group_desc = std::make_shared<util::GroupDescriptor>("BatchGroup", 1);
+                std::atomic<int> ran{0};
+
+                WHEN("A batch holding null tasks and an inline task for that group is submitted") {
+                    std::vector<std::unique_ptr<ReactionTask>> tasks;
+                    tasks.push_back(nullptr);
+                    tasks.push_back(make_inline_group_task(group_desc, ran));
+                    tasks.push_back(nullptr);
+                    scheduler.submit(std::move(tasks));
+
+                    THEN("The inline task runs on the submitting thread") {
+                        CHECK(ran.load(std::memory_order_acquire) == 1);
+                    }
+                }
+            }
+        }
+
     }  // namespace scheduler
 }  // namespace threading
 }  // namespace NUClear
@@ -0,0 +1,203 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "threading/TaskAllocator.hpp"
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace NUClear {
+namespace threading {
+
+    SCENARIO("Blocks freed on the allocating thread are reused", "[threading][TaskAllocator]") {
+        GIVEN("A thread that has allocated and freed a set of blocks") {
+            constexpr int blocks = 100;
+            std::vector<void*> ptrs;
+            for (int i = 0; i < blocks; ++i) {
+                ptrs.push_back(TaskAllocator::allocate(200));
+            }
+            for (auto* ptr : ptrs) {
+                TaskAllocator::deallocate(ptr, 200);
+            }
+            ptrs.clear();
+
+            WHEN("The same number of blocks are allocated again") {
+                const auto before = TaskAllocator::statistics();
+                for (int i = 0; i < blocks; ++i) {
+                    ptrs.push_back(TaskAllocator::allocate(200));
+                }
+                const auto after = TaskAllocator::statistics();
+                for (auto* ptr : ptrs) {
+                    TaskAllocator::deallocate(ptr, 200);
+                }
+
+                THEN("Every request is served without going to the heap") {
+                    CHECK(after.requests - before.requests == blocks);
+                    CHECK(after.heap_allocations == before.heap_allocations);
+                }
+            }
+
+            WHEN("A block larger than the biggest size class is allocated") {
+                constexpr std::size_t size = TaskAllocator::SIZE_CLASSES * TaskAllocator::CLASS_GRANULARITY + 1;
+                const auto before          = TaskAllocator::statistics();
+                void* ptr                  = TaskAllocator::allocate(size);
+                const auto after           = TaskAllocator::statistics();
+                TaskAllocator::deallocate(ptr, size);
+
+                THEN("It comes from the heap") {
+                    CHECK(after.heap_allocations - before.heap_allocations == 1);
+                }
+            }
+        }
+    }
+
+    SCENARIO("Blocks freed on another thread are handed back to the allocating thread", "[threading][TaskAllocator]") {
+        GIVEN("A set of blocks allocated on this thread") {
+            constexpr int blocks = 1000;
+            std::vector<void*> ptrs;
+            for (int i = 0; i < blocks; ++i) {
+                ptrs.push_back(TaskAllocator::allocate(100));
+            }
+
+            WHEN("Another thread frees them and exits") {
+                std::thread([&] {
+                    for (auto* ptr : ptrs) {
+                        TaskAllocator::deallocate(ptr, 100);
+                    }
+                }).join();
+                ptrs.clear();
+
+                AND_WHEN("This thread allocates the same number of blocks again") {
+                    const auto before = TaskAllocator::statistics();
+                    for (int i = 0; i < blocks; ++i) {
+                        ptrs.push_back(TaskAllocator::allocate(100));
+                    }
+                    const auto after = TaskAllocator::statistics();
+                    for (auto* ptr : ptrs) {
+                        TaskAllocator::deallocate(ptr, 100);
+                    }
+
+                    THEN("The returned blocks are reused instead of allocating from the heap") {
+                        CHECK(after.heap_allocations == before.heap_allocations);
+                    }
+                }
+            }
+        }
+    }
+
+    SCENARIO("A thread only holds on to so many blocks handed back by another thread", "[threading][TaskAllocator]") {
+        GIVEN("More blocks than a thread holds on to that were freed on another thread") {
+            constexpr std::size_t blocks = TaskAllocator::MAX_LOCAL_BLOCKS + 100;
+            std::vector<void*> ptrs;
+            for (std::size_t i = 0; i < blocks; ++i) {
+                ptrs.push_back(TaskAllocator::allocate(300));
+            }
+            std::thread([&] {
+                for (auto* ptr : ptrs) {
+                    TaskAllocator::deallocate(ptr, 300);
+                }
+            }).join();
+            ptrs.clear();
+
+            WHEN("This thread allocates one more block than it holds on to") {
+                const auto before = TaskAllocator::statistics();
+                for (std::size_t i = 0; i < TaskAllocator::MAX_LOCAL_BLOCKS + 1; ++i) {
+                    ptrs.push_back(TaskAllocator::allocate(300));
+                }
+                const auto after = TaskAllocator::statistics();
+                for (auto* ptr : ptrs) {
+                    TaskAllocator::deallocate(ptr, 300);
+                }
+
+                THEN("The blocks past the limit went back to the heap, so only the last one comes from it") {
+                    CHECK(after.heap_allocations - before.heap_allocations == 1);
+                }
+            }
+        }
+    }
+
+    SCENARIO("A thread can hand back a partial batch before it sleeps", "[threading][TaskAllocator]") {
+        GIVEN("A few blocks allocated on this thread") {
+            constexpr int blocks = 5;
+            std::vector<void*> ptrs;
+            for (int i = 0; i < blocks; ++i) {
+                ptrs.push_back(TaskAllocator::allocate(400));
+            }
+
+            WHEN("Another thread frees them and flushes without exiting") {
+                std::atomic<bool> flushed{false};
+                std::atomic<bool> done{false};
+                std::thread other([&] {
+                    for (auto* ptr : ptrs) {
+                        TaskAllocator::deallocate(ptr, 400);
+                    }
+                    TaskAllocator::flush_remote();
+                    flushed = true;
+                    while (!done) {
+                        std::this_thread::yield();
+                    }
+                });
+                while (!flushed) {
+                    std::this_thread::yield();
+                }
+                ptrs.clear();
+
+                const auto before = TaskAllocator::statistics();
+                for (int i = 0; i < blocks; ++i) {
+                    ptrs.push_back(TaskAllocator::allocate(400));
+                }
+                const auto after = TaskAllocator::statistics();
+                done = true;
+                other.join();
+                for (auto* ptr : ptrs) {
+                    TaskAllocator::deallocate(ptr, 400);
+                }
+
+                THEN("This thread reuses them straight away") {
+                    CHECK(after.heap_allocations == before.heap_allocations);
+                }
+            }
+        }
+    }
+
+    SCENARIO("Shared objects can be allocated through the task allocator", "[threading][TaskAllocator]") {
+        GIVEN("A shared object made with allocate_shared that has been destroyed") {
+            std::allocate_shared<std::vector<int>>(TaskAllocator::Allocator<std::vector<int>>(), 10, 1).reset();
+
+            WHEN("Another shared object of the same type is made") {
+                const auto before = TaskAllocator::statistics();
+                auto shared = std::allocate_shared<std::vector<int>>(TaskAllocator::Allocator<std::vector<int>>());
+                const auto after = TaskAllocator::statistics();
+
+                THEN("The object and its control block reuse the freed block") {
+                    CHECK(after.requests - before.requests == 1);
+                    CHECK(after.heap_allocations == before.heap_allocations);
+                }
+            }
+        }
+    }
+
+}  // namespace threading
+}  // namespace NUClear
@@ -0,0 +1,174 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "threading/scheduler/queue/WorkStealingQueue.hpp"
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace NUClear {
+namespace threading {
+    namespace scheduler {
+        namespace queue {
+
+            namespace {
+                /// Stand in for Pool::Task: a pair of owning pointers exposed as `task` and `lock`
+                struct Item {
+                    Item(std::unique_ptr<int>&& task = nullptr, std::unique_ptr<int>&& lock = nullptr)
+                        : task(std::move(task)), lock(std::move(lock)) {}
+                    std::unique_ptr<int> task;
+                    std::unique_ptr<int> lock;
+                };
+            }  // namespace
+
+            SCENARIO("A WorkStealingQueue hands items back in FIFO order", "[threading][queue][WorkStealingQueue]") {
+                GIVEN("A queue with several items pushed by its owner") {
+                    WorkStealingQueue<Item, 8> queue;
+                    for (int i = 0; i < 4; ++i) {
+                        REQUIRE(queue.push(Item(std::make_unique<int>(i), std::make_unique<int>(-i))));
+                    }
+
+                    WHEN("The owner pops and a thief steals alternately") {
+                        Item a;
+                        Item b;
+                        Item c;
+                        REQUIRE(queue.pop(a));
+                        REQUIRE(queue.steal(b));
+                        REQUIRE(queue.pop(c));
+
+                        THEN("Both sides take from the oldest end and keep each task paired with its lock") {
+                            CHECK(*a.task == 0);
+                            CHECK(*a.lock == 0);
+                            CHECK(*b.task == 1);
+                            CHECK(*b.lock == -1);
+                            CHECK(*c.task == 2);
+                            CHECK(*c.lock == -2);
+                            CHECK_FALSE(queue.empty());
+                        }
+                    }
+                }
+            }
+
+            SCENARIO("A full WorkStealingQueue refuses pushes without consuming them",
+                     "[threading][queue][WorkStealingQueue]") {
+                GIVEN("A queue filled to capacity") {
+                    WorkStealingQueue<Item, 4> queue;
+                    for (int i = 0; i < 4; ++i) {
+                        REQUIRE(queue.push(Item(std::make_unique<int>(i))));
+                    }
+
+                    WHEN("Another item is pushed") {
+                        Item overflow(std::make_unique<int>(42));
+                        const bool pushed = queue.push(std::move(overflow));
+
+                        THEN("The push fails and the caller still owns the item") {
+                            CHECK_FALSE(pushed);
+                            REQUIRE(overflow.task != nullptr);
+                            CHECK(*overflow.task == 42);
+                        }
+                    }
+
+                    WHEN("One item is taken") {
+                        Item taken;
+                        REQUIRE(queue.steal(taken));
+
+                        THEN("There is room for exactly one more") {
+                            CHECK(queue.push(Item(std::make_unique<int>(4))));
+                            CHECK_FALSE(queue.push(Item(std::make_unique<int>(5))));
+                        }
+                    }
+                }
+            }
+
+            // Stress test: the owner keeps pushing and popping while thieves steal, every item must be taken
+            // exactly once by exactly one side.
+            SCENARIO("A WorkStealingQueue with an owner and many thieves conserves every item",
+                     "[threading][queue][WorkStealingQueue]") {
+                GIVEN("An owner pushing 20000 items and four thieves stealing") {
+                    constexpr int items   = 20000;
+                    constexpr int thieves = 4;
+
+                    WorkStealingQueue<Item, 64> queue;
+                    std::vector<std::atomic<int>> seen(items);
+                    std::atomic<int> taken{0};
+                    std::atomic<bool> done{false};
+
+                    auto record = [&](const Item& item) {
+                        seen[static_cast<std::size_t>(*item.task)].fetch_add(1, std::memory_order_relaxed);
+                        taken.fetch_add(1, std::memory_order_relaxed);
+                    };
+
+                    WHEN("All threads run to completion") {
+                        std::vector<std::thread> threads;
+                        for (int t = 0; t < thieves; ++t) {
+                            threads.emplace_back([&] {
+                                Item item;
+                                while (!done.load(std::memory_order_acquire) || !queue.empty()) {
+                                    if (queue.steal(item)) {
+                                        record(item);
+                                    }
+                                    else {
+                                        std::this_thread::yield();
+                                    }
+                                }
+                            });
+                        }
+
+                        Item item;
+                        for (int i = 0; i < items; ++i) {
+                            Item next(std::make_unique<int>(i));
+                            while (!queue.push(std::move(next))) {
+                                if (queue.pop(item)) {
+                                    record(item);
+                                }
+                            }
+                            if (i % 3 == 0 && queue.pop(item)) {
+                                record(item);
+                            }
+                        }
+                        done.store(true, std::memory_order_release);
+
+                        for (auto& thread : threads) {
+                            thread.join();
+                        }
+
+                        THEN("Every item was taken exactly once") {
+                            CHECK(taken.load() == items);
+                            int duplicates = 0;
+                            for (const auto& s : seen) {
+                                duplicates += s.load() == 1 ? 0 : 1;
+                            }
+                            CHECK(duplicates == 0);
+                            CHECK(queue.empty());
+                        }
+                    }
+                }
+            }
+
+        }  // namespace queue
+    }  // namespace scheduler
+}  // namespace threading
+}  // namespace NUClear
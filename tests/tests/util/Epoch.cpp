@@ -0,0 +1,79 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "util/Epoch.hpp"
+
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+/// How many times each item has been deleted
+std::array<int, 256> deletions{};
+
+/// An object that can retire another one when it is deleted
+struct Item {
+    Item(const int& id, const bool& chain) : id(id), chain(chain) {}
+    int id;
+    bool chain;
+};
+
+void delete_item(const void* ptr) {
+    const auto* item = static_cast<const Item*>(ptr);
+    ++deletions[item->id];
+
+    if (item->chain) {
+        // Retiring and reclaiming from a deleter is what a destructor that emits ends up doing
+        NUClear::util::Epoch::retire(new Item(item->id + 100, false), &delete_item);
+        NUClear::util::Epoch::reclaim();
+
+        // Releasing a guard while a reclaim is waiting checks the retired list again too
+        const NUClear::util::Epoch::Guard guard;
+    }
+
+    delete item;  // NOLINT(cppcoreguidelines-owning-memory)
+}
+
+}  // namespace
+
+
+SCENARIO("Epoch deleters can retire and reclaim themselves", "[util][Epoch]") {
+    GIVEN("Retired items whose deleters retire another item and reclaim") {
+        deletions.fill(0);
+        constexpr int count = 8;
+        for (int i = 0; i < count; ++i) {
+            NUClear::util::Epoch::retire(new Item(i, true), &delete_item);
+        }
+
+        WHEN("They are reclaimed until nothing is left") {
+            for (int i = 0; i < 4; ++i) {
+                NUClear::util::Epoch::reclaim();
+            }
+
+            THEN("Every item is deleted exactly once") {
+                for (int i = 0; i < count; ++i) {
+                    CHECK(deletions[i] == 1);
+                    CHECK(deletions[i + 100] == 1);
+                }
+            }
+        }
+    }
+}
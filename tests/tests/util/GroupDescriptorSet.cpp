@@ -0,0 +1,89 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "util/GroupDescriptorSet.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "util/GroupDescriptor.hpp"
+
+namespace {
+
+using Descriptor = std::shared_ptr<const NUClear::util::GroupDescriptor>;
+
+std::vector<Descriptor> make_descriptors(const int& n) {
+    std::vector<Descriptor> descriptors;
+    for (int i = 0; i < n; ++i) {
+        descriptors.push_back(std::make_shared<const NUClear::util::GroupDescriptor>(std::to_string(i), 1));
+    }
+    return descriptors;
+}
+
+}  // namespace
+
+
+SCENARIO("GroupDescriptorSet behaves like a std::set of descriptors", "[util][GroupDescriptorSet]") {
+
+    const int n = GENERATE(0, 1, 4, 5, 9);
+
+    GIVEN(std::to_string(n) + " descriptors inserted in reverse order with duplicates") {
+        const auto descriptors = make_descriptors(n);
+        NUClear::util::GroupDescriptorSet set;
+        for (auto it = descriptors.rbegin(); it != descriptors.rend(); ++it) {
+            set.insert(*it);
+            set.insert(*it);
+        }
+
+        THEN("It holds each descriptor once in the same order as a std::set") {
+            const std::set<Descriptor> expected(descriptors.begin(), descriptors.end());
+            REQUIRE(set.size() == expected.size());
+            REQUIRE(set.empty() == expected.empty());
+            REQUIRE(std::equal(set.begin(), set.end(), expected.begin(), expected.end()));
+        }
+
+        WHEN("It is built from a std::set of the same descriptors") {
+            const std::set<Descriptor> std_set(descriptors.begin(), descriptors.end());
+            const NUClear::util::GroupDescriptorSet converted(std_set);
+
+            THEN("The two sets are equal") {
+                REQUIRE(converted == set);
+            }
+        }
+
+        WHEN("It is moved") {
+            const NUClear::util::GroupDescriptorSet copy = set;
+            const NUClear::util::GroupDescriptorSet moved(std::move(set));
+
+            THEN("The new set holds the descriptors and the old set is empty") {
+                REQUIRE(moved == copy);
+                REQUIRE(set.empty());  // NOLINT(bugprone-use-after-move,clang-analyzer-cplusplus.Move)
+                REQUIRE(set.begin() == set.end());
+            }
+        }
+    }
+}
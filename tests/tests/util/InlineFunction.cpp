@@ -0,0 +1,125 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "util/InlineFunction.hpp"
+
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+#include "threading/ReactionTask.hpp"
+
+namespace {
+
+using Function = NUClear::util::InlineFunction<int(int), 32>;
+
+struct A {};
+struct B {};
+struct C {};
+
+}  // namespace
+
+
+SCENARIO("InlineFunction stores small callables inside itself", "[util][InlineFunction]") {
+
+    GIVEN("A callable that fits in the buffer") {
+        int offset = 5;
+        auto add   = [&offset](int x) { return x + offset; };
+
+        WHEN("It is stored in an InlineFunction") {
+            Function f(add);
+
+            THEN("It is stored inline and can be called") {
+                STATIC_REQUIRE(Function::stores_inline<decltype(add)>());
+                REQUIRE(f);
+                REQUIRE(f(1) == 6);
+            }
+        }
+    }
+
+    GIVEN("A callable that is bigger than the buffer") {
+        std::array<int, 16> values{};
+        values[3] = 10;
+        auto add  = [values](int x) { return x + values[3]; };
+
+        WHEN("It is stored in an InlineFunction") {
+            Function f(add);
+
+            THEN("It is allocated separately and can still be called") {
+                STATIC_REQUIRE_FALSE(Function::stores_inline<decltype(add)>());
+                REQUIRE(f(1) == 11);
+            }
+        }
+    }
+
+    GIVEN("An empty InlineFunction") {
+        Function f;
+
+        THEN("It converts to false and throws when called") {
+            REQUIRE_FALSE(f);
+            REQUIRE_THROWS_AS(f(1), std::bad_function_call);
+        }
+    }
+}
+
+SCENARIO("InlineFunction holds move only callables", "[util][InlineFunction]") {
+
+    GIVEN("Callables that own a move only value") {
+        auto small = [v = std::make_unique<int>(7)](int x) { return x + *v; };
+        auto large = [v = std::make_unique<int>(7), pad = std::array<char, 64>{}](int x) { return x + *v + pad[0]; };
+
+        WHEN("They are stored and then moved to another InlineFunction") {
+            Function a(std::move(small));
+            Function b(std::move(large));
+            Function c(std::move(a));
+            Function d;
+            d = std::move(b);
+
+            THEN("The moved to functions hold the callables and the moved from functions are empty") {
+                REQUIRE_FALSE(a);
+                REQUIRE_FALSE(b);
+                REQUIRE(c(1) == 8);
+                REQUIRE(d(1) == 8);
+            }
+        }
+    }
+}
+
+SCENARIO("Typical reaction callbacks are stored inside the task", "[util][InlineFunction]") {
+
+    GIVEN("A callback bound with the data for Trigger<A>, With<B>, With<C>") {
+        struct Reactor {};
+        Reactor* reactor = nullptr;
+        auto callback    = [reactor](const A&, const B&, const C&) { std::ignore = reactor; };
+        auto data        = std::make_tuple(std::make_shared<A>(), std::make_shared<B>(), std::make_shared<C>());
+        auto bound       = [callback, data](NUClear::threading::ReactionTask& /*task*/) noexcept {
+            std::ignore = callback;
+            std::ignore = data;
+        };
+
+        THEN("It fits in a ReactionTask's callback without allocating") {
+            STATIC_REQUIRE(NUClear::threading::ReactionTask::TaskFunction::stores_inline<decltype(bound)>());
+        }
+    }
+}
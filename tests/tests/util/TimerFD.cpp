@@ -0,0 +1,86 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "util/TimerFD.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <thread>
+
+SCENARIO("TimerFD sleeps until its deadline", "[util][TimerFD]") {
+    NUClear::util::TimerFD timer;
+    if (!timer.valid()) {
+        SKIP("There is no kernel timer on this platform");
+    }
+
+    WHEN("It waits for a duration") {
+        const auto start = std::chrono::steady_clock::now();
+        timer.wait_for(std::chrono::milliseconds(5));
+        const auto end = std::chrono::steady_clock::now();
+
+        THEN("It does not wake before the deadline") {
+            REQUIRE(end - start >= std::chrono::milliseconds(5));
+        }
+    }
+
+    WHEN("It waits for a deadline that has already passed") {
+        const auto start = std::chrono::steady_clock::now();
+        timer.wait_for(std::chrono::milliseconds(-5));
+        const auto end = std::chrono::steady_clock::now();
+
+        THEN("It returns straight away") {
+            REQUIRE(end - start < std::chrono::seconds(1));
+        }
+    }
+}
+
+SCENARIO("TimerFD can be woken before its deadline", "[util][TimerFD]") {
+    NUClear::util::TimerFD timer;
+    if (!timer.valid()) {
+        SKIP("There is no kernel timer on this platform");
+    }
+
+    WHEN("It is notified before it starts waiting") {
+        timer.notify();
+        const auto start = std::chrono::steady_clock::now();
+        timer.wait_for(std::chrono::seconds(10));
+        const auto end = std::chrono::steady_clock::now();
+
+        THEN("The notification is not lost") {
+            REQUIRE(end - start < std::chrono::seconds(5));
+        }
+    }
+
+    WHEN("It is notified from another thread while waiting") {
+        std::thread waker([&timer] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            timer.notify();
+        });
+        const auto start = std::chrono::steady_clock::now();
+        timer.wait();
+        const auto end = std::chrono::steady_clock::now();
+        waker.join();
+
+        THEN("It wakes up") {
+            REQUIRE(end - start < std::chrono::seconds(5));
+        }
+    }
+}
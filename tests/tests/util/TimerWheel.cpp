@@ -0,0 +1,152 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "util/TimerWheel.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "clock.hpp"
+
+namespace {
+
+using NUClear::clock;
+using Wheel = NUClear::util::TimerWheel<int>;
+
+}  // namespace
+
+
+SCENARIO("TimerWheel hands out timers in the order they are due", "[util][TimerWheel]") {
+    GIVEN("A wheel with timers inserted out of order") {
+        Wheel wheel;
+        const auto start = clock::now();
+        const std::vector<int> offsets{500, 3, 1000000, 3, 70000, 0, 999999999, 12};
+        for (std::size_t i = 0; i < offsets.size(); ++i) {
+            wheel.insert(i, start + std::chrono::nanoseconds(offsets[i]), offsets[i]);
+        }
+
+        THEN("They come out sorted by time with their exact due time") {
+            std::vector<int> seen;
+            while (!wheel.empty()) {
+                const auto next  = wheel.next();
+                const auto timer = wheel.pop();
+                REQUIRE(timer.time == next);
+                REQUIRE(timer.time == start + std::chrono::nanoseconds(timer.value));
+                seen.push_back(timer.value);
+            }
+            REQUIRE(seen == std::vector<int>{0, 3, 3, 12, 500, 70000, 1000000, 999999999});
+        }
+
+        WHEN("Some of them are cancelled") {
+            REQUIRE(wheel.cancel(2));
+            REQUIRE(wheel.cancel(5));
+            REQUIRE_FALSE(wheel.cancel(100));
+
+            THEN("Only the others come out") {
+                std::vector<int> seen;
+                while (!wheel.empty()) {
+                    seen.push_back(wheel.pop().value);
+                }
+                REQUIRE(seen == std::vector<int>{3, 3, 12, 500, 70000, 999999999});
+            }
+        }
+
+        WHEN("Every timer is shifted") {
+            wheel.shift(std::chrono::seconds(-5));
+
+            THEN("Every due time moves by the same amount") {
+                REQUIRE(wheel.next() == start - std::chrono::seconds(5));
+                REQUIRE(wheel.size() == offsets.size());
+            }
+        }
+    }
+}
+
+SCENARIO("TimerWheel matches a sorted container under random use", "[util][TimerWheel]") {
+    GIVEN("A wheel and a reference multimap receiving the same operations") {
+        Wheel wheel;
+        std::multimap<clock::time_point, int> reference;
+        std::mt19937 rng(1234);
+        auto now = clock::now();
+        int next_id = 0;
+
+        WHEN("Timers are inserted, cancelled and popped while time moves forward and back") {
+            for (int step = 0; step < 20000; ++step) {
+                const auto op = rng() % 10;
+                if (op < 5) {
+                    // Mostly near future timers with some far away and some already due
+                    const int64_t range = (rng() % 4 == 0) ? 10000000000LL : 1000000LL;
+                    const auto time     = now + std::chrono::nanoseconds(int64_t(rng() % range) - 1000);
+                    wheel.insert(next_id, time, next_id);
+                    reference.emplace(time, next_id);
+                    ++next_id;
+                }
+                else if (op < 7 && next_id > 0) {
+                    const int id = int(rng() % next_id);
+                    for (auto it = reference.begin(); it != reference.end(); ++it) {
+                        if (it->second == id) {
+                            reference.erase(it);
+                            break;
+                        }
+                    }
+                    wheel.cancel(id);
+                }
+                else if (op < 9) {
+                    now += std::chrono::nanoseconds(rng() % 100000);
+                    while (!wheel.empty() && wheel.next() <= now) {
+                        const auto timer = wheel.pop();
+                        REQUIRE(timer.time == reference.begin()->first);
+                        auto range = reference.equal_range(timer.time);
+                        bool found = false;
+                        for (auto it = range.first; it != range.second; ++it) {
+                            if (it->second == timer.value) {
+                                reference.erase(it);
+                                found = true;
+                                break;
+                            }
+                        }
+                        REQUIRE(found);
+                    }
+                }
+                else {
+                    // Occasionally the clock is set backwards
+                    now -= std::chrono::nanoseconds(rng() % 1000000);
+                    wheel.rewind(now);
+                }
+                REQUIRE(wheel.size() == reference.size());
+                if (!wheel.empty()) {
+                    REQUIRE(wheel.next() == reference.begin()->first);
+                }
+            }
+
+            THEN("Both agree on every remaining timer") {
+                while (!wheel.empty()) {
+                    REQUIRE(wheel.pop().time == reference.begin()->first);
+                    reference.erase(reference.begin());
+                }
+                REQUIRE(reference.empty());
+            }
+        }
+    }
+}
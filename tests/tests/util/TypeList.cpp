@@ -0,0 +1,180 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "util/TypeList.hpp"
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "util/Epoch.hpp"
+
+namespace {
+
+template <typename Tag>
+using List = NUClear::util::TypeList<Tag, Tag, std::shared_ptr<int>>;
+
+template <typename Tag>
+std::vector<int> values() {
+    std::vector<int> out;
+    for (const auto& v : List<Tag>::get()) {
+        out.push_back(*v);
+    }
+    return out;
+}
+
+}  // namespace
+
+
+SCENARIO("TypeList snapshots are not affected by later changes", "[util][TypeList]") {
+    struct Tag {};
+
+    GIVEN("A list with three values") {
+        List<Tag>::add(std::make_shared<int>(1));
+        List<Tag>::add(std::make_shared<int>(2));
+        List<Tag>::add(std::make_shared<int>(3));
+
+        WHEN("A snapshot is taken and the list is then modified") {
+            const auto snapshot = List<Tag>::get();
+            List<Tag>::remove_if([](const std::shared_ptr<int>& v) { return *v == 2; });
+            List<Tag>::add(std::make_shared<int>(4));
+
+            THEN("The snapshot still holds the original values") {
+                std::vector<int> seen;
+                for (const auto& v : snapshot) {
+                    seen.push_back(*v);
+                }
+                REQUIRE(seen == std::vector<int>{1, 2, 3});
+            }
+            AND_THEN("A new snapshot holds the modified values") {
+                REQUIRE(values<Tag>() == std::vector<int>{1, 3, 4});
+            }
+        }
+
+        // Leave the list empty for the next section
+        List<Tag>::remove_if([](const std::shared_ptr<int>&) { return true; });
+    }
+}
+
+SCENARIO("TypeList releases values once no snapshot can see them", "[util][TypeList]") {
+    struct Tag {};
+
+    GIVEN("A list holding the only reference to a value") {
+        List<Tag>::add(std::make_shared<int>(1));
+        const std::weak_ptr<int> weak = *List<Tag>::get().begin();
+
+        WHEN("The value is removed while a snapshot is held") {
+            {
+                const auto snapshot = List<Tag>::get();
+                List<Tag>::remove_if([](const std::shared_ptr<int>&) { return true; });
+
+                THEN("The value is kept alive by the snapshot") {
+                    REQUIRE_FALSE(weak.expired());
+                    REQUIRE(List<Tag>::get().empty());
+                }
+            }
+
+            THEN("The value is released when the snapshot is released") {
+                REQUIRE(weak.expired());
+                REQUIRE(NUClear::util::Epoch::pending() == 0);
+            }
+        }
+    }
+}
+
+SCENARIO("TypeList shared lists keep their values without holding back other deletions", "[util][TypeList]") {
+    struct Tag {};
+
+    GIVEN("A list holding the only reference to a value") {
+        List<Tag>::add(std::make_shared<int>(1));
+        const std::weak_ptr<int> weak = *List<Tag>::get().begin();
+
+        WHEN("The list is shared and the value is then removed") {
+            auto shared = List<Tag>::share();
+            List<Tag>::remove_if([](const std::shared_ptr<int>&) { return true; });
+
+            THEN("The shared list still holds the value while nothing is left waiting to be deleted") {
+                REQUIRE(shared->size() == 1);
+                REQUIRE_FALSE(weak.expired());
+                REQUIRE(NUClear::util::Epoch::pending() == 0);
+                REQUIRE(List<Tag>::get().empty());
+            }
+
+            shared.reset();
+            AND_THEN("The value is released with the last shared reference") {
+                REQUIRE(weak.expired());
+            }
+        }
+    }
+
+    GIVEN("A list that has never been added to") {
+        struct Empty {};
+        THEN("Sharing it gives nothing") {
+            REQUIRE(List<Empty>::share() == nullptr);
+        }
+    }
+}
+
+SCENARIO("TypeList can be modified while other threads are reading it", "[util][TypeList]") {
+    struct Tag {};
+    constexpr int n_readers = 4;
+    constexpr int n_updates = 2000;
+
+    GIVEN("Threads that continually read the list") {
+        std::atomic<bool> done{false};
+        std::atomic<int> bad_reads{0};
+        std::vector<std::thread> readers;
+        for (int i = 0; i < n_readers; ++i) {
+            readers.emplace_back([&] {
+                while (!done.load()) {
+                    for (const auto& v : List<Tag>::get()) {
+                        if (v == nullptr || *v != 42) {
+                            ++bad_reads;
+                        }
+                    }
+                }
+            });
+        }
+
+        WHEN("Values are added and removed at the same time") {
+            for (int i = 0; i < n_updates; ++i) {
+                List<Tag>::add(std::make_shared<int>(42));
+                if (i % 2 == 1) {
+                    List<Tag>::remove_if([](const std::shared_ptr<int>&) { return true; });
+                }
+            }
+            done = true;
+            for (auto& t : readers) {
+                t.join();
+            }
+            NUClear::util::Epoch::reclaim();
+
+            THEN("Every reader only saw live values") {
+                REQUIRE(bad_reads == 0);
+            }
+            AND_THEN("Every old list has been deleted") {
+                REQUIRE(NUClear::util::Epoch::pending() == 0);
+            }
+        }
+    }
+}
@@ -0,0 +1,208 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "util/TypeMap.hpp"
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "util/Epoch.hpp"
+
+namespace {
+
+template <typename Tag>
+using Map = NUClear::util::TypeMap<Tag, Tag, int>;
+
+}  // namespace
+
+
+SCENARIO("TypeMap returns the most recently stored value", "[util][TypeMap]") {
+    struct Tag {};
+
+    GIVEN("An empty map") {
+        THEN("It returns nullptr") {
+            REQUIRE(Map<Tag>::get() == nullptr);
+        }
+
+        WHEN("Two values are stored") {
+            const auto first  = std::make_shared<int>(1);
+            const auto second = std::make_shared<int>(2);
+            const std::weak_ptr<int> weak_first = first;
+            Map<Tag>::set(first);
+            Map<Tag>::set(second);
+
+            THEN("The second value is returned") {
+                REQUIRE(Map<Tag>::get() == second);
+            }
+            AND_WHEN("The old value is reclaimed") {
+                NUClear::util::Epoch::reclaim();
+
+                THEN("The map no longer holds a reference to it") {
+                    REQUIRE(weak_first.use_count() == 1);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("TypeMap only holds back a bounded number of replaced values", "[util][TypeMap]") {
+    struct Tag {};
+    constexpr std::size_t limit = 2 * NUClear::util::Epoch::RECLAIM_THRESHOLD;
+
+    GIVEN("A map holding a value") {
+        std::weak_ptr<int> weak_first;
+        {
+            const auto first = std::make_shared<int>(1);
+            weak_first       = first;
+            Map<Tag>::set(first);
+        }
+
+        WHEN("It is replaced while nothing is reading it") {
+            std::size_t writes = 0;
+            while (!weak_first.expired() && writes < limit) {
+                Map<Tag>::set(std::make_shared<int>(2));
+                ++writes;
+            }
+
+            THEN("The old value is destroyed within a batch of writes") {
+                REQUIRE(weak_first.expired());
+            }
+        }
+
+        WHEN("It is replaced while another thread holds a guard") {
+            std::atomic<bool> guarded{false};
+            std::atomic<bool> release{false};
+            std::thread reader([&] {
+                const NUClear::util::Epoch::Guard guard;
+                guarded = true;
+                while (!release) {
+                    std::this_thread::yield();
+                }
+            });
+            while (!guarded) {
+                std::this_thread::yield();
+            }
+            for (std::size_t i = 0; i < limit; ++i) {
+                Map<Tag>::set(std::make_shared<int>(2));
+            }
+
+            THEN("The old value is kept until the reader lets go") {
+                REQUIRE(!weak_first.expired());
+                release = true;
+                reader.join();
+
+                // The writer checks again once it has written enough more
+                std::size_t writes = 0;
+                while (!weak_first.expired() && writes < 2 * limit) {
+                    Map<Tag>::set(std::make_shared<int>(3));
+                    ++writes;
+                }
+                REQUIRE(weak_first.expired());
+            }
+        }
+    }
+}
+
+SCENARIO("TypeMap can be read while other threads are writing it", "[util][TypeMap]") {
+    struct Tag {};
+    constexpr int n_readers = 4;
+    constexpr int n_writes  = 20000;
+
+    GIVEN("A map with a value and threads that continually read it") {
+        Map<Tag>::set(std::make_shared<int>(0));
+
+        std::atomic<bool> done{false};
+        std::atomic<int> bad_reads{0};
+        std::vector<std::thread> readers;
+        for (int i = 0; i < n_readers; ++i) {
+            readers.emplace_back([&] {
+                int last = 0;
+                while (!done.load()) {
+                    const auto value = Map<Tag>::get();
+                    // Values are only ever increasing, anything else means we read freed memory
+                    if (value == nullptr || *value < last) {
+                        ++bad_reads;
+                    }
+                    else {
+                        last = *value;
+                    }
+                }
+            });
+        }
+
+        WHEN("New values are stored at the same time") {
+            for (int i = 1; i <= n_writes; ++i) {
+                Map<Tag>::set(std::make_shared<int>(i));
+            }
+            done = true;
+            for (auto& t : readers) {
+                t.join();
+            }
+            NUClear::util::Epoch::reclaim();
+
+            THEN("Every reader only saw valid values") {
+                REQUIRE(bad_reads == 0);
+                REQUIRE(*Map<Tag>::get() == n_writes);
+            }
+            AND_THEN("Every old value has been released") {
+                REQUIRE(NUClear::util::Epoch::pending() == 0);
+            }
+        }
+    }
+}
+
+SCENARIO("Values replaced while a reader holds a guard are released once it lets go", "[util][TypeMap]") {
+    struct Tag {};
+
+    GIVEN("A reader that holds a guard") {
+        auto guard = std::make_unique<NUClear::util::Epoch::Guard>();
+
+        WHEN("Many values are stored while the guard is held") {
+            constexpr int n_writes = 1000;
+            std::weak_ptr<int> weak_first;
+            for (int i = 1; i <= n_writes; ++i) {
+                auto value = std::make_shared<int>(i);
+                if (i == 1) {
+                    weak_first = value;
+                }
+                Map<Tag>::set(std::move(value));
+            }
+
+            THEN("The old values are kept for the reader") {
+                REQUIRE(!weak_first.expired());
+                REQUIRE(NUClear::util::Epoch::pending() >= std::size_t(n_writes - 1));
+            }
+            AND_WHEN("The reader releases its guard") {
+                guard.reset();
+                NUClear::util::Epoch::reclaim();
+
+                THEN("Every old value has been released") {
+                    REQUIRE(weak_first.expired());
+                    REQUIRE(NUClear::util::Epoch::pending() == 0);
+                }
+            }
+        }
+    }
+}
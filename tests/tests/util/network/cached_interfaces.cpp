@@ -0,0 +1,95 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "util/network/cached_interfaces.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <vector>
+
+#include "util/network/get_interfaces.hpp"
+#include "util/network/if_number_from_address.hpp"
+#include "util/platform.hpp"
+
+namespace {
+
+    bool same(const NUClear::util::network::Interface& a, const NUClear::util::network::Interface& b) {
+        return a.name == b.name && a.index == b.index && a.ip.sock.sa_family == b.ip.sock.sa_family
+               && std::memcmp(&a.ip, &b.ip, a.ip.size()) == 0;
+    }
+
+}  // namespace
+
+TEST_CASE("cached interfaces match the interfaces on the system", "[util][network][cached_interfaces]") {
+    const auto live = NUClear::util::network::get_interfaces();
+
+    SECTION("A snapshot lists the same interfaces") {
+        const auto cached = NUClear::util::network::cached_interfaces();
+        REQUIRE(cached.size() == live.size());
+        for (const auto& iface : live) {
+            CHECK(std::any_of(cached.begin(), cached.end(), [&](const auto& c) { return same(c, iface); }));
+        }
+    }
+
+    SECTION("A snapshot stays valid across refreshes") {
+        const auto before = NUClear::util::network::cached_interfaces();
+        NUClear::util::network::refresh_interfaces();
+        NUClear::util::network::refresh_interfaces();
+        const auto after = NUClear::util::network::cached_interfaces();
+
+        REQUIRE(before.size() == live.size());
+        REQUIRE(after.size() == live.size());
+        for (const auto& iface : before) {
+            CHECK(std::any_of(after.begin(), after.end(), [&](const auto& c) { return same(c, iface); }));
+        }
+    }
+
+    SECTION("Refreshing for an address that isn't ours keeps the same interfaces") {
+        // 203.0.113.0/24 is reserved for documentation so it is never one of our addresses
+        NUClear::util::network::sock_t unknown{};
+        unknown.ipv4.sin_family      = AF_INET;
+        unknown.ipv4.sin_addr.s_addr = htonl(0xCB007101);
+
+        const auto before = NUClear::util::network::cached_interfaces();
+        for (int i = 0; i < 100; ++i) {
+            NUClear::util::network::refresh_interfaces(unknown);
+        }
+        const auto after = NUClear::util::network::cached_interfaces();
+
+        REQUIRE(after.size() == live.size());
+        for (const auto& iface : before) {
+            CHECK(std::any_of(after.begin(), after.end(), [&](const auto& c) { return same(c, iface); }));
+        }
+        CHECK(std::none_of(after.begin(), after.end(), [&](const auto& c) {
+            return c.ip.sock.sa_family == AF_INET && c.ip.ipv4.sin_addr.s_addr == unknown.ipv4.sin_addr.s_addr;
+        }));
+    }
+
+    SECTION("Interface numbers come from the cached table") {
+        for (const auto& iface : live) {
+            if (iface.ip.sock.sa_family == AF_INET6) {
+                CHECK(NUClear::util::network::if_number_from_address(iface.ip.ipv6) == iface.index);
+            }
+        }
+    }
+}
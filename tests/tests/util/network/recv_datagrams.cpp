@@ -0,0 +1,144 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "util/network/recv_datagrams.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "util/FileDescriptor.hpp"
+#include "util/network/sock_t.hpp"
+#include "util/platform.hpp"
+
+namespace {
+
+    /// Makes a UDP socket bound to an ephemeral port on the IPv4 loopback address
+    NUClear::util::FileDescriptor loopback_socket(NUClear::util::network::sock_t& address) {
+        NUClear::util::FileDescriptor fd(::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP));
+        address                      = NUClear::util::network::sock_t{};
+        address.ipv4.sin_family      = AF_INET;
+        address.ipv4.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t len                = sizeof(address.ipv4);
+        ::bind(fd.get(), &address.sock, len);
+        ::getsockname(fd.get(), &address.sock, &len);
+        return fd;
+    }
+
+}  // namespace
+
+SCENARIO("recv_datagrams says when there may be more datagrams waiting", "[util][network][recv_datagrams]") {
+    using NUClear::util::network::MAX_DATAGRAMS;
+    using NUClear::util::network::recv_datagrams;
+
+    GIVEN("A socket with more datagrams waiting than fit in one batch") {
+        NUClear::util::network::sock_t address{};
+        NUClear::util::FileDescriptor receiver = loopback_socket(address);
+        NUClear::util::network::sock_t unused{};
+        NUClear::util::FileDescriptor sender = loopback_socket(unused);
+
+        constexpr std::size_t extra = 3;
+        for (std::size_t i = 0; i < MAX_DATAGRAMS + extra; ++i) {
+            const uint8_t value = uint8_t(i);
+            ::sendto(sender.get(), reinterpret_cast<const char*>(&value), 1, 0, &address.sock, address.size());
+        }
+
+        WHEN("Batches are received until one says there are no more") {
+            std::size_t count   = 0;
+            std::size_t batches = 0;
+            bool more           = true;
+            while (more && batches <= MAX_DATAGRAMS + extra) {
+                const auto batch = recv_datagrams(receiver.get(), false);
+                for (const auto& datagram : batch.datagrams) {
+                    REQUIRE(datagram.size == 1);
+                    CHECK(*datagram.data == uint8_t(count++));
+                }
+                more = batch.more;
+                ++batches;
+            }
+
+            THEN("Every datagram has been received in order") {
+                CHECK(count == MAX_DATAGRAMS + extra);
+            }
+            AND_THEN("Nothing is left waiting") {
+                CHECK(recv_datagrams(receiver.get(), false).datagrams.empty());
+            }
+        }
+    }
+}
+
+SCENARIO("recv_datagrams batches keep their datagrams after later batches are received",
+         "[util][network][recv_datagrams]") {
+    using NUClear::util::network::recv_datagrams;
+
+    GIVEN("A socket that is sent datagrams of different sizes") {
+        NUClear::util::network::sock_t address{};
+        NUClear::util::FileDescriptor receiver = loopback_socket(address);
+        NUClear::util::network::sock_t unused{};
+        NUClear::util::FileDescriptor sender = loopback_socket(unused);
+
+        auto send = [&](const std::vector<std::size_t>& sizes, const uint8_t& first) {
+            uint8_t value = first;
+            for (const auto& size : sizes) {
+                const std::vector<uint8_t> payload(size, value++);
+                ::sendto(sender.get(),
+                         reinterpret_cast<const char*>(payload.data()),
+                         static_cast<socklen_t>(payload.size()),
+                         0,
+                         &address.sock,
+                         address.size());
+            }
+        };
+        auto matches = [](const NUClear::util::network::DatagramBatch& batch,
+                          const std::vector<std::size_t>& sizes,
+                          const uint8_t& first) {
+            if (batch.datagrams.size() != sizes.size()) {
+                return false;
+            }
+            for (std::size_t i = 0; i < sizes.size(); ++i) {
+                const auto& d = batch.datagrams[i];
+                if (d.size != sizes[i] || std::any_of(d.data, d.data + d.size, [&](const uint8_t& v) {
+                        return v != uint8_t(first + i);
+                    })) {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        const std::vector<std::size_t> first_sizes  = {1, 1000, 0, 3, 60000};
+        const std::vector<std::size_t> second_sizes = {7000, 5};
+
+        WHEN("A batch is held while another is received") {
+            send(first_sizes, 10);
+            const auto first = recv_datagrams(receiver.get(), false);
+            send(second_sizes, 100);
+            const auto second = recv_datagrams(receiver.get(), false);
+
+            THEN("Both batches hold the datagrams they received") {
+                CHECK(matches(first, first_sizes, 10));
+                CHECK(matches(second, second_sizes, 100));
+            }
+        }
+    }
+}